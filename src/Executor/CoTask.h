@@ -0,0 +1,663 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "TaskWeave/Edge.h"
+#include "TaskWeave/IEdge.h"
+#include "TaskWeave/Task.h"
+#include "IThreadPool.h"
+
+// STL
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace tw {
+
+/**
+ * @brief State shared by every CoTask promise: scheduling, continuation and completion.
+ *
+ * The pool is the thread pool the coroutine is resumed on after a suspension. It is
+ * set by CoTask::start(IThreadPool&), by co_await schedule(pool), or inherited from
+ * the coroutine awaiting this one. Without a pool, the coroutine resumes inline on
+ * whichever thread completes the awaited operation.
+ */
+class CoTaskPromiseBase {
+public:
+    /**
+     * @brief Awaitable run when the coroutine body finishes.
+     *
+     * Publishes the result to the outward edge, marks the promise finished and
+     * transfers control to the awaiting coroutine, if any.
+     */
+    struct FinalAwaitable {
+        auto await_ready() const noexcept -> bool
+        {
+            return false;
+        }
+
+        template<typename Promise>
+        auto await_suspend(std::coroutine_handle<Promise> handle) noexcept -> std::coroutine_handle<>
+        {
+            auto& promise = handle.promise();
+            const std::coroutine_handle<> continuation = promise.continuation_;
+            promise.publish();
+            // Last access to the frame: an owner blocked in CoTask::wait() may destroy it from here on
+            promise.is_finished_.store(true, std::memory_order_release);
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        auto await_resume() const noexcept -> void
+        {
+        }
+    };
+
+    /**
+     * @brief CoTasks are lazy: the body starts on start() or co_await.
+     * @return Always-suspend awaitable.
+     */
+    auto initial_suspend() const noexcept -> std::suspend_always
+    {
+        return {};
+    }
+
+    /**
+     * @brief Publishes the result and resumes the awaiting coroutine.
+     * @return Final awaitable.
+     */
+    auto final_suspend() const noexcept -> FinalAwaitable
+    {
+        return {};
+    }
+
+    /**
+     * @brief Stores an exception escaping the coroutine body; rethrown when the result is read.
+     */
+    auto unhandled_exception() noexcept -> void
+    {
+        exception_ = std::current_exception();
+    }
+
+    /**
+     * @brief Returns the thread pool the coroutine resumes on.
+     * @return Pool pointer, or nullptr to resume inline.
+     */
+    auto get_pool() const noexcept -> IThreadPool*
+    {
+        return pool_;
+    }
+
+    /**
+     * @brief Sets the thread pool the coroutine resumes on.
+     * @param pool Pool pointer, or nullptr to resume inline.
+     */
+    auto set_pool(IThreadPool* pool) noexcept -> void
+    {
+        pool_ = pool;
+    }
+
+    /**
+     * @brief Sets the coroutine resumed when this one finishes.
+     * @param continuation Awaiting coroutine.
+     */
+    auto set_continuation(std::coroutine_handle<> continuation) noexcept -> void
+    {
+        continuation_ = continuation;
+    }
+
+    /**
+     * @brief Checks whether the coroutine has finished and released its frame.
+     * @return true once the frame may be destroyed.
+     */
+    auto is_finished() const noexcept -> bool
+    {
+        return is_finished_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Rethrows the exception that escaped the coroutine body, if any.
+     */
+    auto rethrow_if_failed() const -> void
+    {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+protected:
+    /**
+     * @brief Returns the exception that escaped the coroutine body.
+     * @return Exception, or nullptr if the body completed.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr&
+    {
+        return exception_;
+    }
+
+private:
+    IThreadPool* pool_ = nullptr;            ///< Pool the coroutine resumes on (nullptr = inline)
+    std::coroutine_handle<> continuation_{}; ///< Coroutine awaiting this one
+    std::exception_ptr exception_;           ///< Exception that escaped the body
+    std::atomic<bool> is_finished_{false};   ///< Set after the result is published
+};
+
+/**
+ * @brief Promise part holding the result of a CoTask in its outward edge.
+ * @tparam T Result type.
+ */
+template<typename T>
+class CoTaskPromise : public CoTaskPromiseBase {
+public:
+    /**
+     * @brief Stores the value of a co_return statement.
+     * @param value Result value.
+     */
+    template<typename U = T>
+    auto return_value(U&& value) -> void
+    {
+        value_ = std::forward<U>(value);
+    }
+
+    /**
+     * @brief Moves the result into the outward edge and marks it retrievable.
+     *
+     * If the body threw, the edge is failed with the exception instead.
+     */
+    auto publish() noexcept -> void
+    {
+        if (get_exception()) {
+            result_.set_failed(get_exception());
+        }
+        else {
+            result_.set_data(std::move(value_));
+        }
+    }
+
+    /**
+     * @brief Returns the edge carrying the result.
+     * @return Outward edge (owner is nullptr: a coroutine is not a graph node).
+     */
+    auto get_outward_edge() noexcept -> Edge<T>&
+    {
+        return result_;
+    }
+
+private:
+    T value_{};               ///< Result until publish()
+    Edge<T> result_{nullptr}; ///< Result once published
+};
+
+/**
+ * @brief Promise part of a CoTask returning nothing.
+ */
+template<>
+class CoTaskPromise<void> : public CoTaskPromiseBase {
+public:
+    /**
+     * @brief Handles a co_return statement without value (or flowing off the end).
+     */
+    auto return_void() const noexcept -> void
+    {
+    }
+
+    /**
+     * @brief Marks the outward edge retrievable.
+     *
+     * If the body threw, the edge is failed with the exception instead.
+     */
+    auto publish() noexcept -> void
+    {
+        if (get_exception()) {
+            result_.set_failed(get_exception());
+        }
+        else {
+            result_.set_data();
+        }
+    }
+
+    /**
+     * @brief Returns the edge signalling completion.
+     * @return Outward edge (owner is nullptr: a coroutine is not a graph node).
+     */
+    auto get_outward_edge() noexcept -> Edge<void>&
+    {
+        return result_;
+    }
+
+private:
+    Edge<void> result_{nullptr}; ///< Completion signal
+};
+
+/**
+ * @brief Returns the pool a suspended coroutine should be resumed on.
+ * @tparam Promise Promise type of the awaiting coroutine.
+ * @param handle Awaiting coroutine.
+ * @return The CoTask's pool, or nullptr for other coroutine types.
+ */
+template<typename Promise>
+auto get_resume_pool(std::coroutine_handle<Promise> handle) noexcept -> IThreadPool*
+{
+    if constexpr (std::is_base_of_v<CoTaskPromiseBase, Promise>) {
+        return handle.promise().get_pool();
+    }
+    else {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Resumes a coroutine on a thread pool, or inline without one.
+ * @param pool Pool to post the resumption to, or nullptr.
+ * @param handle Coroutine to resume.
+ */
+inline auto resume_on(IThreadPool* pool, std::coroutine_handle<> handle) -> void
+{
+    if (pool == nullptr) {
+        handle.resume();
+        return;
+    }
+    pool->add_task([handle]() {
+        handle.resume();
+    });
+}
+
+/**
+ * @brief Awaitable suspending a coroutine until an edge becomes retrievable.
+ *
+ * The coroutine registers itself as an EdgeWaiter instead of blocking its thread;
+ * the producer's set_data() posts the resumption to the coroutine's pool.
+ *
+ * @tparam T Edge data type.
+ */
+template<typename T>
+class EdgeAwaitable : private EdgeWaiter {
+public:
+    /**
+     * @brief Constructs an awaitable for the given edge.
+     * @param edge Edge to wait for.
+     */
+    explicit EdgeAwaitable(const Edge<T>& edge) noexcept
+        : edge_(&edge)
+    {
+    }
+
+    auto await_ready() const noexcept -> bool
+    {
+        return edge_->is_retrievable();
+    }
+
+    template<typename Promise>
+    auto await_suspend(std::coroutine_handle<Promise> handle) noexcept -> bool
+    {
+        handle_ = handle;
+        pool_ = get_resume_pool(handle);
+        on_ready = &EdgeAwaitable::resume;
+        // false: the data landed in the meantime, continue without suspending
+        return edge_->add_waiter(this);
+    }
+
+    /**
+     * @brief Returns the edge data.
+     * @return Const reference to the data (nothing for Edge<void>), valid while the edge is.
+     * @throws The producer's exception if the edge failed (TaskCancelled if it carries none).
+     */
+    auto await_resume() const -> decltype(auto)
+    {
+        if (edge_->has_failed()) {
+            const std::exception_ptr& error = edge_->get_exception();
+            std::rethrow_exception(error ? error : task_cancelled_exception());
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return edge_->get_data_ref();
+        }
+    }
+
+private:
+    /**
+     * @brief EdgeWaiter callback, invoked by the producing thread.
+     * @param waiter This awaitable.
+     */
+    static auto resume(EdgeWaiter* waiter) -> void
+    {
+        auto* self = static_cast<EdgeAwaitable*>(waiter);
+        resume_on(self->pool_, self->handle_);
+    }
+
+private:
+    const Edge<T>* edge_;              ///< Awaited edge
+    std::coroutine_handle<> handle_{}; ///< Suspended coroutine
+    IThreadPool* pool_ = nullptr;      ///< Pool to resume on
+};
+
+/**
+ * @brief Suspends the coroutine until the edge data is set.
+ * @param edge Edge to wait for.
+ * @return Awaitable yielding a const reference to the data.
+ */
+template<typename T>
+auto operator co_await(const Edge<T>& edge) noexcept -> EdgeAwaitable<T>
+{
+    return EdgeAwaitable<T>{edge};
+}
+
+/**
+ * @brief Suspends the coroutine until the task has run.
+ * @param task Task to wait for.
+ * @return Awaitable yielding a const reference to the task result.
+ */
+template<typename ReturnT, typename... InputTs>
+auto operator co_await(const Task<ReturnT, InputTs...>& task) noexcept -> EdgeAwaitable<ReturnT>
+{
+    return EdgeAwaitable<ReturnT>{*task.get_outward_edge()};
+}
+
+/**
+ * @brief Awaitable moving the awaiting coroutine onto a thread pool.
+ *
+ * The pool also becomes the coroutine's resume pool for later suspensions.
+ */
+class ScheduleAwaitable {
+public:
+    /**
+     * @brief Constructs an awaitable for the given pool.
+     * @param pool Pool to continue on.
+     */
+    explicit ScheduleAwaitable(IThreadPool& pool) noexcept
+        : pool_(&pool)
+    {
+    }
+
+    auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    template<typename Promise>
+    auto await_suspend(std::coroutine_handle<Promise> handle) -> void
+    {
+        if constexpr (std::is_base_of_v<CoTaskPromiseBase, Promise>) {
+            handle.promise().set_pool(pool_);
+        }
+        resume_on(pool_, handle);
+    }
+
+    auto await_resume() const noexcept -> void
+    {
+    }
+
+private:
+    IThreadPool* pool_; ///< Pool to continue on
+};
+
+/**
+ * @brief Reschedules the awaiting coroutine onto a thread pool.
+ * @param pool Pool to continue on.
+ * @return Awaitable for co_await.
+ */
+inline auto schedule(IThreadPool& pool) noexcept -> ScheduleAwaitable
+{
+    return ScheduleAwaitable{pool};
+}
+
+/**
+ * @brief Coroutine task that suspends instead of blocking a worker thread.
+ *
+ * A CoTask is a C++20 coroutine returning T. Inside it:
+ * - co_await edge (Edge<T>&) or co_await task (Task<T, ...>&) suspends until the
+ *   data is retrievable and yields a const reference to it
+ * - co_await other_co_task runs another CoTask and yields its result
+ * - co_await schedule(pool) continues on a thread pool
+ *
+ * A suspended coroutine holds no thread: the producer of the awaited edge posts
+ * its resumption to the coroutine's pool. Latency-bound work (I/O, timers, other
+ * graphs) can thus be mixed into a graph without adding worker threads.
+ *
+ * The result lives in an outward edge, so graph tasks can consume a coroutine's
+ * result with add_inward_edge(co_task.get_outward_edge()).
+ *
+ * Lifetime:
+ * - CoTasks are lazy; start them with start(pool) / start(), or co_await them
+ *   from another coroutine (not both)
+ * - A started CoTask must not be destroyed before wait() returns
+ * - A thread pool does not count a suspended coroutine as active: wait for the
+ *   CoTask itself (wait() or its outward edge), not only for the pool
+ *
+ * Usage:
+ * @code
+ * auto fetch = [](const Task<int>& producer) -> CoTask<int> {
+ *     const int& value = co_await producer; // worker is free while waiting
+ *     co_return value * 2;
+ * };
+ * CoTask<int> co_task = fetch(producer);
+ * co_task.start(pool);
+ * co_task.wait();
+ * int result = co_task.get_result();
+ * @endcode
+ *
+ * @tparam T Result type (void allowed).
+ */
+template<typename T = void>
+class CoTask {
+public:
+    /**
+     * @brief Coroutine promise type.
+     */
+    class promise_type : public CoTaskPromise<T> {
+    public:
+        auto get_return_object() noexcept -> CoTask
+        {
+            return CoTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+    };
+
+    /**
+     * @brief Awaitable running the CoTask as a child of the awaiting coroutine.
+     */
+    class Awaitable {
+    public:
+        /**
+         * @brief Constructs the awaitable.
+         * @param handle Child coroutine.
+         * @param move_result Whether the result can be moved out (the CoTask is an rvalue).
+         */
+        Awaitable(std::coroutine_handle<promise_type> handle, bool move_result) noexcept
+            : handle_(handle)
+            , move_result_(move_result)
+        {
+        }
+
+        auto await_ready() const noexcept -> bool
+        {
+            return handle_.done();
+        }
+
+        template<typename Promise>
+        auto await_suspend(std::coroutine_handle<Promise> awaiting) noexcept -> std::coroutine_handle<>
+        {
+            auto& promise = handle_.promise();
+            promise.set_pool(get_resume_pool(awaiting));
+            promise.set_continuation(awaiting);
+            if constexpr (!std::is_void_v<T>) {
+                if (move_result_) {
+                    // Sole registered consumer: take_data() moves instead of copying
+                    promise.get_outward_edge().set_transfer_mode(EdgeTransferMode::MoveToLastConsumer);
+                    promise.get_outward_edge().add_consumer();
+                }
+            }
+            return handle_;
+        }
+
+        auto await_resume() const -> T
+        {
+            handle_.promise().rethrow_if_failed();
+            if constexpr (!std::is_void_v<T>) {
+                const auto& edge = handle_.promise().get_outward_edge();
+                return move_result_ ? edge.take_data() : edge.get_data();
+            }
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_; ///< Child coroutine
+        bool move_result_;                           ///< Result is taken rather than copied
+    };
+
+public:
+    /**
+     * @brief Constructs an empty CoTask.
+     */
+    CoTask() = default;
+
+    /**
+     * @brief Destroys the coroutine frame.
+     *
+     * @note The coroutine must not be suspended mid-body (never started, or finished).
+     */
+    ~CoTask()
+    {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Uncopyable class
+    CoTask(const CoTask&) = delete;
+    auto operator=(const CoTask&) -> CoTask& = delete;
+
+    /**
+     * @brief Move constructor - takes over the coroutine frame.
+     * @param other CoTask to move from (left empty).
+     */
+    CoTask(CoTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr))
+        , is_started_(std::exchange(other.is_started_, false))
+    {
+    }
+
+    /**
+     * @brief Move assignment operator - takes over the coroutine frame.
+     * @param other CoTask to move from (left empty).
+     * @return Reference to this CoTask.
+     */
+    auto operator=(CoTask&& other) noexcept -> CoTask&
+    {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+            is_started_ = std::exchange(other.is_started_, false);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Starts the coroutine on a thread pool.
+     * @param pool Pool running the body and every resumption.
+     */
+    auto start(IThreadPool& pool) -> void
+    {
+        assert(handle_ && !is_started_);
+        is_started_ = true;
+        handle_.promise().set_pool(&pool);
+        resume_on(&pool, handle_);
+    }
+
+    /**
+     * @brief Starts the coroutine on the calling thread; it runs until its first suspension.
+     *
+     * Without a pool, later resumptions run inline on the threads completing the awaited operations.
+     */
+    auto start() -> void
+    {
+        assert(handle_ && !is_started_);
+        is_started_ = true;
+        handle_.resume();
+    }
+
+    /**
+     * @brief Blocks until the coroutine has finished.
+     *
+     * @note Waits on the outward edge, then for the frame to be released.
+     */
+    auto wait() const noexcept -> void
+    {
+        handle_.promise().get_outward_edge().wait_until_retrievable();
+        while (!handle_.promise().is_finished()) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Checks whether the coroutine has finished.
+     * @return true if the result is available.
+     */
+    auto is_done() const noexcept -> bool
+    {
+        return handle_ && handle_.promise().is_finished();
+    }
+
+    /**
+     * @brief Returns the result of the coroutine.
+     * @return Copy of the result (nothing for CoTask<void>).
+     *
+     * Should be called after wait() returns.
+     *
+     * @throws Any exception that escaped the coroutine body.
+     */
+    auto get_result() const -> T
+    {
+        handle_.promise().rethrow_if_failed();
+        if constexpr (!std::is_void_v<T>) {
+            return handle_.promise().get_outward_edge().get_data();
+        }
+    }
+
+    /**
+     * @brief Returns the edge carrying the result, for graph tasks or other coroutines.
+     * @return Pointer to the outward edge.
+     */
+    auto get_outward_edge() const noexcept -> const Edge<T>*
+    {
+        return &handle_.promise().get_outward_edge();
+    }
+
+    /**
+     * @brief Awaits the CoTask from another coroutine, moving its result out.
+     * @return Awaitable yielding the result.
+     */
+    auto operator co_await() && noexcept -> Awaitable
+    {
+        return Awaitable{handle_, true};
+    }
+
+    /**
+     * @brief Awaits the CoTask from another coroutine, copying its result.
+     * @return Awaitable yielding the result.
+     */
+    auto operator co_await() & noexcept -> Awaitable
+    {
+        return Awaitable{handle_, false};
+    }
+
+private:
+    /**
+     * @brief Constructs a CoTask owning the given coroutine frame.
+     * @param handle Coroutine handle.
+     */
+    explicit CoTask(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle)
+    {
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_{}; ///< Owned coroutine frame
+    bool is_started_ = false;                      ///< start() was called
+};
+
+} // namespace tw
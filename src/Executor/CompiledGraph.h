@@ -0,0 +1,273 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "TaskWeave/Helper.h"
+#include "TaskWeave/IEdge.h"
+#include "TaskWeave/INode.h"
+#include "TaskWeave/ITask.h"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Immutable, re-runnable dependency structure of a set of tasks.
+ *
+ * CompiledGraph does the per-graph preparation of ThreadPoolExecutor once:
+ * - Computes reachability and sorts the tasks topologically
+ * - Builds successor lists (flattened, CSR layout) and per-task predecessor counts
+ * - Records the root tasks (no predecessor inside the graph)
+ * - Computes each task's critical-path priority: the length of the longest
+ *   chain of work from the task to a sink, the task included
+ *
+ * The graph can then be executed many times with ThreadPoolExecutor::run(CompiledGraph&).
+ * reset() restores every task, edge and counter in O(tasks) without allocating.
+ *
+ * @note Only inward edges whose owner is part of the graph are tracked. A task
+ *       depending on a task outside the graph still waits for that edge inside its worker.
+ * @note Edges added to the tasks after construction are not seen; build a new graph instead.
+ *
+ * Usage:
+ * @code
+ * CompiledGraph graph{std::vector<ITask*>{&task1, &task2}};
+ * ThreadPoolExecutor executor;
+ * for (int frame = 0; frame < 100; frame++) {
+ *     executor.run(graph);
+ *     executor.wait();
+ * }
+ * @endcode
+ */
+class CompiledGraph {
+public:
+    /**
+     * @brief Constructs an empty graph.
+     */
+    CompiledGraph() = default;
+
+    /**
+     * @brief Compiles the dependency structure of the given tasks.
+     * @tparam TaskRange Range of ITask pointers.
+     * @param tasks Tasks making up the graph. Null pointers are ignored.
+     */
+    template<std::ranges::input_range TaskRange>
+    explicit CompiledGraph(TaskRange&& tasks)
+    {
+        for (ITask* task : tasks) {
+            if (task) {
+                tasks_.emplace_back(task);
+            }
+        }
+        compile();
+    }
+
+    // Uncopyable class
+    CompiledGraph(const CompiledGraph&) = delete;
+    auto operator=(const CompiledGraph&) -> CompiledGraph& = delete;
+
+    CompiledGraph(CompiledGraph&&) noexcept = default;
+    auto operator=(CompiledGraph&&) noexcept -> CompiledGraph& = default;
+
+    /**
+     * @brief Restores the graph so it can be executed again.
+     *
+     * Resets every task (state and outward edge) and every pending-predecessor counter.
+     *
+     * @note O(tasks), no allocation. Must not be called while the graph is running.
+     */
+    auto reset() noexcept -> void
+    {
+        for (size_t i = 0; i < tasks_.size(); i++) {
+            tasks_[i]->reset();
+            pending_predecessors_[i].store(predecessor_counts_[i], std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the number of tasks in the graph.
+     * @return Task count.
+     */
+    auto size() const noexcept -> size_t
+    {
+        return tasks_.size();
+    }
+
+    /**
+     * @brief Checks whether the graph has no task.
+     * @return true if the graph is empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return tasks_.empty();
+    }
+
+    /**
+     * @brief Returns the tasks in topological order.
+     * @return Span of task pointers.
+     */
+    auto get_tasks() const noexcept -> std::span<ITask* const>
+    {
+        return tasks_;
+    }
+
+    /**
+     * @brief Returns the task at the given index.
+     * @param index Position in topological order.
+     * @return Task pointer.
+     */
+    auto get_task(size_t index) const noexcept -> ITask*
+    {
+        return tasks_[index];
+    }
+
+    /**
+     * @brief Returns the indices of tasks without predecessors inside the graph.
+     * @return Span of root task indices.
+     */
+    auto get_roots() const noexcept -> std::span<const size_t>
+    {
+        return roots_;
+    }
+
+    /**
+     * @brief Returns the indices of the tasks consuming the given task's output.
+     * @param index Position of the producing task.
+     * @return Span of successor indices.
+     */
+    auto get_successors(size_t index) const noexcept -> std::span<const size_t>
+    {
+        return std::span<const size_t>{successors_}.subspan(
+            successor_offsets_[index], successor_offsets_[index + 1] - successor_offsets_[index]);
+    }
+
+    /**
+     * @brief Records that one predecessor of the given task has completed.
+     * @param index Position of the successor task.
+     * @return true if this was the last pending predecessor (the task is now ready).
+     *
+     * @note Thread-safe: atomic decrement.
+     */
+    auto release_predecessor(size_t index) noexcept -> bool
+    {
+        return pending_predecessors_[index].fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    /**
+     * @brief Recomputes the critical-path priority of every task.
+     * @param weighted_by_duration If true, a task weighs its last measured duration
+     *        (ITask::get_duration, in microseconds, plus one); otherwise every task weighs 1.
+     *
+     * priority(task) = weight(task) + max(priority(successor)), computed in one
+     * reverse-topological pass. The graph computes unweighted priorities on construction.
+     *
+     * @note O(tasks + edges), no allocation. Must not be called while the graph is running.
+     */
+    auto compute_priorities(bool weighted_by_duration) noexcept -> void
+    {
+        for (size_t i = tasks_.size(); i-- > 0;) {
+            uint64_t weight = 1;
+            if (weighted_by_duration) {
+                const auto duration = tasks_[i]->get_duration<std::chrono::microseconds>().count();
+                weight += duration > 0 ? static_cast<uint64_t>(duration) : 0;
+            }
+            uint64_t downstream = 0;
+            for (auto successor : get_successors(i)) {
+                downstream = std::max(downstream, priorities_[successor]);
+            }
+            priorities_[i] = weight + downstream;
+        }
+    }
+
+    /**
+     * @brief Returns the critical-path priority of a task.
+     * @param index Position of the task.
+     * @return Length of the longest remaining chain starting at the task (higher runs first).
+     */
+    auto get_priority(size_t index) const noexcept -> uint64_t
+    {
+        return priorities_[index];
+    }
+
+private:
+    /**
+     * @brief Sorts the tasks and builds the successor table, counters, roots and priorities.
+     */
+    auto compile() -> void
+    {
+        tw::compute_reachability(tasks_);
+        std::stable_sort(tasks_.begin(), tasks_.end(), [](auto a, auto b) {
+            return *a < *b;
+        });
+
+        const size_t task_count = tasks_.size();
+        std::unordered_map<const INode*, size_t> index_of;
+        index_of.reserve(task_count);
+        for (size_t i = 0; i < task_count; i++) {
+            index_of.emplace(tasks_[i]->as_node(), i);
+        }
+
+        // (producer, consumer) pairs, then bucketed by producer
+        std::vector<std::pair<size_t, size_t>> links;
+        predecessor_counts_.assign(task_count, 0);
+        for (size_t i = 0; i < task_count; i++) {
+            const INode* node = tasks_[i]->as_node();
+            for (size_t slot = 0; slot < node->get_inward_edges_count(); slot++) {
+                const IEdge* edge = node->get_inward_edge(slot);
+                if (edge == nullptr) {
+                    continue;
+                }
+                auto it = index_of.find(edge->get_owner());
+                if (it != index_of.end()) {
+                    links.emplace_back(it->second, i);
+                    predecessor_counts_[i]++;
+                }
+            }
+        }
+
+        successor_offsets_.assign(task_count + 1, 0);
+        for (const auto& [producer, consumer] : links) {
+            successor_offsets_[producer + 1]++;
+        }
+        for (size_t i = 0; i < task_count; i++) {
+            successor_offsets_[i + 1] += successor_offsets_[i];
+        }
+        successors_.resize(links.size());
+        std::vector<size_t> cursor(successor_offsets_.begin(), successor_offsets_.end() - 1);
+        for (const auto& [producer, consumer] : links) {
+            successors_[cursor[producer]++] = consumer;
+        }
+
+        pending_predecessors_ = std::vector<std::atomic<size_t>>(task_count);
+        for (size_t i = 0; i < task_count; i++) {
+            pending_predecessors_[i].store(predecessor_counts_[i], std::memory_order_relaxed);
+            if (predecessor_counts_[i] == 0) {
+                roots_.push_back(i);
+            }
+        }
+
+        priorities_.assign(task_count, 0);
+        compute_priorities(false);
+    }
+
+private:
+    std::vector<ITask*> tasks_;                             ///< Tasks in topological order
+    std::vector<size_t> successor_offsets_;                 ///< successors_ range of task i: [offsets[i], offsets[i + 1])
+    std::vector<size_t> successors_;                        ///< Flattened successor indices
+    std::vector<size_t> predecessor_counts_;                ///< In-graph predecessor count per task (reset value)
+    std::vector<std::atomic<size_t>> pending_predecessors_; ///< Unfinished predecessors per task (current run)
+    std::vector<size_t> roots_;                             ///< Tasks without in-graph predecessors
+    std::vector<uint64_t> priorities_;                      ///< Critical-path length per task
+};
+
+} // namespace tw
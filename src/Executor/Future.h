@@ -0,0 +1,833 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "TaskWeave/IEdge.h"
+#include "IThreadPool.h"
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace tw {
+
+template<typename T>
+class Future;
+
+namespace detail {
+
+/**
+ * @brief Per-thread free list of fixed-size memory blocks.
+ *
+ * Future shared states are allocated and released at a high rate; recycling
+ * their blocks avoids a trip through the global allocator for each submit().
+ * A block released on another thread than the one that allocated it joins that
+ * thread's list.
+ *
+ * @tparam Size Block size in bytes.
+ * @tparam Align Block alignment.
+ */
+template<size_t Size, size_t Align>
+class RecycledBlocks {
+public:
+    /**
+     * @brief Returns a block, reusing one from the calling thread's list when possible.
+     * @return Uninitialized block of Size bytes.
+     */
+    static auto allocate() -> void*
+    {
+        Cache& cache = cache_;
+        if (cache.count != 0) {
+            return cache.blocks[--cache.count];
+        }
+        return ::operator new(Size, std::align_val_t{Align});
+    }
+
+    /**
+     * @brief Returns a block to the calling thread's list, or frees it if the list is full.
+     * @param block Block obtained from allocate().
+     */
+    static auto deallocate(void* block) noexcept -> void
+    {
+        Cache& cache = cache_;
+        if (cache.count < kMaxBlocks) {
+            cache.blocks[cache.count++] = block;
+            return;
+        }
+        ::operator delete(block, std::align_val_t{Align});
+    }
+
+private:
+    static constexpr size_t kMaxBlocks = 256; ///< Per-thread cap on recycled blocks
+
+    /**
+     * @brief Blocks recycled on one thread, freed at thread exit.
+     */
+    struct Cache {
+        ~Cache()
+        {
+            for (size_t i = 0; i < count; i++) {
+                ::operator delete(blocks[i], std::align_val_t{Align});
+            }
+        }
+
+        std::array<void*, kMaxBlocks> blocks{}; ///< Recycled blocks
+        size_t count = 0;                        ///< Number of blocks in use of blocks
+    };
+
+    static inline thread_local Cache cache_; ///< Blocks of the calling thread
+};
+
+/**
+ * @brief Storable form of a future value: void becomes std::monostate.
+ */
+template<typename T>
+using FutureValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+/**
+ * @brief Shared state of a Future: the value or exception, and the ready signal.
+ *
+ * The ready signal is an IEdge without an owner node, so a Future is waited on
+ * like any edge: blocking waits use its atomic wait/notify, and continuations
+ * (then, when_all, when_any) register as EdgeWaiters called back by the
+ * producing thread. The state is reference counted between the Future and its
+ * producer and lives in a recycled block.
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+class FutureState : public IEdge {
+public:
+    /**
+     * @brief Creates a state in a recycled block.
+     * @param pool Pool continuations run on by default (may be nullptr: inline).
+     * @param refs Initial number of references.
+     * @return New state.
+     */
+    static auto create(IThreadPool* pool, uint32_t refs) -> FutureState*
+    {
+        void* block = RecycledBlocks<sizeof(FutureState), alignof(FutureState)>::allocate();
+        return new (block) FutureState(pool, refs);
+    }
+
+    // Uncopyable class
+    FutureState(const FutureState&) = delete;
+    auto operator=(const FutureState&) -> FutureState& = delete;
+
+    // Unmovable class
+    FutureState(FutureState&&) = delete;
+    auto operator=(FutureState&&) -> FutureState& = delete;
+
+    /**
+     * @brief Drops one reference, destroying the state with the last one.
+     */
+    auto release() noexcept -> void
+    {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~FutureState();
+            RecycledBlocks<sizeof(FutureState), alignof(FutureState)>::deallocate(this);
+        }
+    }
+
+    /**
+     * @brief Stores the value and wakes the waiters.
+     * @param args Arguments constructing the value (none for void).
+     */
+    template<typename... Args>
+    auto set_value(Args&&... args) -> void
+    {
+        value_.emplace(std::forward<Args>(args)...);
+        set_as_retrievable();
+    }
+
+    /**
+     * @brief Stores an exception and wakes the waiters.
+     * @param error Exception rethrown by Future::get().
+     */
+    auto set_exception(std::exception_ptr error) noexcept -> void
+    {
+        error_ = std::move(error);
+        set_as_failed();
+    }
+
+    /**
+     * @brief Returns the stored value.
+     * @return Reference to the value; only valid once ready without an exception.
+     */
+    auto get_value() noexcept -> FutureValue<T>&
+    {
+        return *value_;
+    }
+
+    /**
+     * @brief Returns the stored exception.
+     * @return The exception, or nullptr if the state holds a value.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr&
+    {
+        return error_;
+    }
+
+    /**
+     * @brief Returns the pool continuations run on by default.
+     * @return Pool, or nullptr to run continuations on the completing thread.
+     */
+    auto get_pool() const noexcept -> IThreadPool*
+    {
+        return pool_;
+    }
+
+private:
+    FutureState(IThreadPool* pool, uint32_t refs)
+        : IEdge(nullptr)
+        , pool_(pool)
+        , refs_(refs)
+    {
+    }
+
+    ~FutureState() = default;
+
+private:
+    IThreadPool* pool_;                   ///< Default pool of continuations
+    std::atomic<uint32_t> refs_;          ///< Future and producer references
+    std::optional<FutureValue<T>> value_; ///< Value, once set
+    std::exception_ptr error_;            ///< Exception, once set
+};
+
+/**
+ * @brief Producer side of a FutureState; breaks the promise if destroyed before setting it.
+ *
+ * Held by the pool job or continuation that computes the value, so a job dropped
+ * by IThreadPool::clear_queued_tasks() still makes its Future ready (with
+ * std::future_errc::broken_promise) instead of leaving get() blocked forever.
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+class FutureSetter {
+public:
+    /**
+     * @brief Takes over one reference to a state.
+     * @param state State to set.
+     */
+    explicit FutureSetter(FutureState<T>* state) noexcept
+        : state_(state)
+    {
+    }
+
+    FutureSetter(FutureSetter&& other) noexcept
+        : state_(std::exchange(other.state_, nullptr))
+    {
+    }
+
+    ~FutureSetter()
+    {
+        if (state_ != nullptr) {
+            set_exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+    }
+
+    // Uncopyable class
+    FutureSetter(const FutureSetter&) = delete;
+    auto operator=(const FutureSetter&) -> FutureSetter& = delete;
+    auto operator=(FutureSetter&&) -> FutureSetter& = delete;
+
+    /**
+     * @brief Invokes fn and stores its result, or the exception it throws.
+     * @param fn Callable.
+     * @param args Arguments to invoke fn with.
+     */
+    template<typename Fn, typename... Args>
+    auto invoke(Fn& fn, Args&&... args) -> void
+    {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                std::invoke(fn, std::forward<Args>(args)...);
+                state_->set_value();
+            }
+            else {
+                state_->set_value(std::invoke(fn, std::forward<Args>(args)...));
+            }
+        }
+        catch (...) {
+            state_->set_exception(std::current_exception());
+        }
+        std::exchange(state_, nullptr)->release();
+    }
+
+    /**
+     * @brief Stores a value.
+     * @param args Arguments constructing the value.
+     */
+    template<typename... Args>
+    auto set_value(Args&&... args) -> void
+    {
+        try {
+            state_->set_value(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            state_->set_exception(std::current_exception());
+        }
+        std::exchange(state_, nullptr)->release();
+    }
+
+    /**
+     * @brief Stores an exception.
+     * @param error Exception to store.
+     */
+    auto set_exception(std::exception_ptr error) noexcept -> void
+    {
+        state_->set_exception(std::move(error));
+        std::exchange(state_, nullptr)->release();
+    }
+
+private:
+    FutureState<T>* state_; ///< State to set, nullptr once set
+};
+
+/**
+ * @brief Continuation registered by Future::then(): runs fn on the source value once it is ready.
+ *
+ * @tparam T Source value type.
+ * @tparam R Result value type.
+ * @tparam Fn Continuation callable.
+ */
+template<typename T, typename R, typename Fn>
+class ThenWaiter : private EdgeWaiter {
+public:
+    ThenWaiter(FutureState<T>* source, FutureState<R>* result, IThreadPool* pool, Fn fn)
+        : EdgeWaiter{.next = nullptr, .on_ready = &ThenWaiter::on_ready}
+        , source_(source)
+        , setter_(result)
+        , pool_(pool)
+        , fn_(std::move(fn))
+    {
+    }
+
+    ~ThenWaiter()
+    {
+        source_->release();
+    }
+
+    // Uncopyable class
+    ThenWaiter(const ThenWaiter&) = delete;
+    auto operator=(const ThenWaiter&) -> ThenWaiter& = delete;
+
+    // Unmovable class
+    ThenWaiter(ThenWaiter&&) = delete;
+    auto operator=(ThenWaiter&&) -> ThenWaiter& = delete;
+
+    /**
+     * @brief Registers the continuation on its source, or schedules it if the source is ready.
+     * @param waiter Continuation; owned by the source's waiter list until scheduled.
+     */
+    static auto arm(std::unique_ptr<ThenWaiter> waiter) -> void
+    {
+        ThenWaiter* raw = waiter.release();
+        if (!raw->source_->add_waiter(raw)) {
+            schedule(raw);
+        }
+    }
+
+private:
+    static auto on_ready(EdgeWaiter* waiter) -> void
+    {
+        schedule(static_cast<ThenWaiter*>(waiter));
+    }
+
+    /**
+     * @brief Submits the continuation to its pool, or runs it inline without one.
+     * @param waiter Continuation, deleted once it has run (or its job is dropped).
+     */
+    static auto schedule(ThenWaiter* waiter) -> void
+    {
+        std::unique_ptr<ThenWaiter> owned(waiter);
+        IThreadPool* pool = owned->pool_;
+        if (pool == nullptr) {
+            owned->run();
+            return;
+        }
+        pool->add_task([owned = std::move(owned)]() {
+            owned->run();
+        });
+    }
+
+    /**
+     * @brief Runs fn on the source value, or forwards the source's exception.
+     */
+    auto run() -> void
+    {
+        if (source_->get_exception()) {
+            setter_.set_exception(source_->get_exception());
+        }
+        else if constexpr (std::is_void_v<T>) {
+            setter_.invoke(fn_);
+        }
+        else {
+            setter_.invoke(fn_, std::move(source_->get_value()));
+        }
+    }
+
+private:
+    FutureState<T>* source_; ///< Source state (one reference)
+    FutureSetter<R> setter_; ///< Result
+    IThreadPool* pool_;      ///< Pool running the continuation, nullptr for inline
+    Fn fn_;                  ///< Continuation callable
+};
+
+/**
+ * @brief Result type of a continuation invoked with a future's value.
+ */
+template<typename T, typename Fn>
+struct ContinuationResult {
+    using type = std::invoke_result_t<Fn&, T&&>;
+};
+
+template<typename Fn>
+struct ContinuationResult<void, Fn> {
+    using type = std::invoke_result_t<Fn&>;
+};
+
+} // namespace detail
+
+/**
+ * @brief Handle to a value computed asynchronously, e.g. by submit().
+ *
+ * A lightweight, move-only alternative to std::future: the shared state sits in
+ * a recycled block, and readiness is a single atomic flag with wait/notify (no
+ * mutex). Continuations attached with then() run on a thread pool once the value
+ * is ready, without blocking any thread; when_all() and when_any() combine futures.
+ *
+ * @tparam T Value type (may be void).
+ *
+ * Usage:
+ * @code
+ * Future<int> parsed = submit(pool, parse, text);
+ * Future<std::string> rendered = std::move(parsed).then([](int value) { return std::to_string(value); });
+ * std::string text = rendered.get();
+ * @endcode
+ */
+template<typename T>
+class Future {
+public:
+    using value_type = T;
+
+public:
+    /**
+     * @brief Creates an invalid future (no shared state).
+     */
+    Future() noexcept = default;
+
+    /**
+     * @brief Takes over one reference to a shared state.
+     * @param state Shared state.
+     */
+    explicit Future(detail::FutureState<T>* state) noexcept
+        : state_(state)
+    {
+    }
+
+    Future(Future&& other) noexcept
+        : state_(std::exchange(other.state_, nullptr))
+    {
+    }
+
+    auto operator=(Future&& other) noexcept -> Future&
+    {
+        if (this != &other) {
+            reset();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Drops the reference to the shared state; does not wait.
+     */
+    ~Future()
+    {
+        reset();
+    }
+
+    // Uncopyable class
+    Future(const Future&) = delete;
+    auto operator=(const Future&) -> Future& = delete;
+
+    /**
+     * @brief Checks whether the future refers to a shared state.
+     * @return false after get(), then() or a move.
+     */
+    auto valid() const noexcept -> bool
+    {
+        return state_ != nullptr;
+    }
+
+    /**
+     * @brief Checks whether the value (or exception) is available.
+     * @return true if get() would not block.
+     */
+    auto is_ready() const noexcept -> bool
+    {
+        return state_->is_retrievable();
+    }
+
+    /**
+     * @brief Blocks until the value (or exception) is available.
+     */
+    auto wait() const noexcept -> void
+    {
+        state_->wait_until_retrievable();
+    }
+
+    /**
+     * @brief Waits for the value and moves it out, or rethrows the stored exception.
+     * @return The value (nothing for void).
+     *
+     * @note The future becomes invalid.
+     */
+    auto get() -> T
+    {
+        wait();
+        auto state = std::unique_ptr<detail::FutureState<T>, StateRelease>(std::exchange(state_, nullptr));
+        if (state->get_exception()) {
+            std::rethrow_exception(state->get_exception());
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(state->get_value());
+        }
+    }
+
+    /**
+     * @brief Attaches a continuation that runs on a pool once the value is ready.
+     * @tparam Fn Callable invoked with the value as an rvalue (no argument for void).
+     * @param pool Pool running the continuation.
+     * @param fn Continuation.
+     * @return Future of fn's result; carries this future's exception instead if there is one.
+     *
+     * @note The future becomes invalid. No thread blocks while waiting for the value.
+     */
+    template<typename Fn>
+    auto then(IThreadPool& pool, Fn&& fn) && -> Future<typename detail::ContinuationResult<T, std::decay_t<Fn>>::type>
+    {
+        return std::move(*this).then_on(&pool, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Attaches a continuation that runs on this future's pool once the value is ready.
+     * @tparam Fn Callable invoked with the value as an rvalue (no argument for void).
+     * @param fn Continuation.
+     * @return Future of fn's result.
+     *
+     * @note Runs on the pool the value was submitted to; a future without a pool
+     *       (e.g. from when_all of an empty range) runs fn on the completing thread.
+     */
+    template<typename Fn>
+    auto then(Fn&& fn) && -> Future<typename detail::ContinuationResult<T, std::decay_t<Fn>>::type>
+    {
+        IThreadPool* pool = state_->get_pool();
+        return std::move(*this).then_on(pool, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Registers a waiter to be called back once the future is ready.
+     * @param waiter Waiter record; must stay alive until its on_ready callback runs.
+     * @return false if the future is already ready (the waiter is not registered).
+     *
+     * @note See IEdge::add_waiter(); used by when_all() and when_any().
+     */
+    auto add_waiter(EdgeWaiter* waiter) const noexcept -> bool
+    {
+        return state_->add_waiter(waiter);
+    }
+
+    /**
+     * @brief Returns the pool continuations attached with then(fn) run on.
+     * @return Pool, or nullptr for inline continuations.
+     */
+    auto get_pool() const noexcept -> IThreadPool*
+    {
+        return state_->get_pool();
+    }
+
+private:
+    /**
+     * @brief Releases a state reference when a unique_ptr goes away.
+     */
+    struct StateRelease {
+        auto operator()(detail::FutureState<T>* state) const noexcept -> void
+        {
+            state->release();
+        }
+    };
+
+    /**
+     * @brief Attaches a continuation running on the given pool (or inline for nullptr).
+     */
+    template<typename Fn>
+    auto then_on(IThreadPool* pool, Fn&& fn) && -> Future<typename detail::ContinuationResult<T, std::decay_t<Fn>>::type>
+    {
+        using R = typename detail::ContinuationResult<T, std::decay_t<Fn>>::type;
+        auto* result = detail::FutureState<R>::create(pool, 2);
+        detail::ThenWaiter<T, R, std::decay_t<Fn>>::arm(std::make_unique<detail::ThenWaiter<T, R, std::decay_t<Fn>>>(
+            std::exchange(state_, nullptr), result, pool, std::forward<Fn>(fn)));
+        return Future<R>(result);
+    }
+
+    /**
+     * @brief Drops the reference to the shared state, if any.
+     */
+    auto reset() noexcept -> void
+    {
+        if (state_ != nullptr) {
+            std::exchange(state_, nullptr)->release();
+        }
+    }
+
+private:
+    detail::FutureState<T>* state_ = nullptr; ///< Shared state, nullptr when invalid
+};
+
+/**
+ * @brief Submits a callable to a priority lane of a pool and returns a future of its result.
+ * @param pool Pool running the callable.
+ * @param priority Lane to queue the callable in.
+ * @param fn Callable.
+ * @param args Arguments to invoke fn with.
+ * @return Future of fn's result, or of the exception it throws.
+ */
+template<typename Fn, typename... Args>
+auto submit(IThreadPool& pool, TaskPriority priority, Fn&& fn, Args&&... args)
+    -> Future<std::invoke_result_t<std::decay_t<Fn>&, std::decay_t<Args>&...>>
+{
+    using R = std::invoke_result_t<std::decay_t<Fn>&, std::decay_t<Args>&...>;
+    auto* state = detail::FutureState<R>::create(&pool, 2);
+    pool.add_task(priority, [setter = detail::FutureSetter<R>(state), f = std::forward<Fn>(fn),
+                             ... captured_args = std::forward<Args>(args)]() mutable {
+        setter.invoke(f, captured_args...);
+    });
+    return Future<R>(state);
+}
+
+/**
+ * @brief Submits a callable to a pool and returns a future of its result.
+ * @tparam Fn Callable type.
+ * @tparam Args Argument types, stored by value.
+ * @param pool Pool running the callable; continuations attached with then(fn) run there too.
+ * @param fn Callable.
+ * @param args Arguments to invoke fn with.
+ * @return Future of fn's result, or of the exception it throws.
+ *
+ * @note If the job is dropped by clear_queued_tasks(), the future holds
+ *       std::future_error(std::future_errc::broken_promise).
+ */
+template<typename Fn, typename... Args>
+auto submit(IThreadPool& pool, Fn&& fn, Args&&... args)
+    -> Future<std::invoke_result_t<std::decay_t<Fn>&, std::decay_t<Args>&...>>
+{
+    return submit(pool, TaskPriority::Normal, std::forward<Fn>(fn), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Value of when_all(): the values in input order (nothing for void).
+ */
+template<typename T>
+using WhenAllValue = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+/**
+ * @brief Value of when_any(): the index of the first future to become ready, and all the futures.
+ */
+template<typename T>
+struct WhenAnyResult {
+    size_t index;                   ///< First ready future, or SIZE_MAX for an empty input
+    std::vector<Future<T>> futures; ///< The input futures, in input order
+};
+
+namespace detail {
+
+/**
+ * @brief Shared record of a when_all() or when_any(): one EdgeWaiter per input.
+ *
+ * The record is reference counted by the inputs (plus one while arming) and
+ * deleted by the last callback.
+ *
+ * @tparam T Input value type.
+ * @tparam R Result value type.
+ * @tparam IsAny true for when_any().
+ */
+template<typename T, typename R, bool IsAny>
+class CombineWaiter {
+public:
+    CombineWaiter(std::vector<Future<T>> futures, FutureState<R>* result)
+        : futures_(std::move(futures))
+        , slots_(futures_.size())
+        , pending_(futures_.size() + 1)
+        , setter_(result)
+    {
+    }
+
+    // Uncopyable class
+    CombineWaiter(const CombineWaiter&) = delete;
+    auto operator=(const CombineWaiter&) -> CombineWaiter& = delete;
+
+    // Unmovable class
+    CombineWaiter(CombineWaiter&&) = delete;
+    auto operator=(CombineWaiter&&) -> CombineWaiter& = delete;
+
+    /**
+     * @brief Registers a waiter on every input; inputs that are already ready count as arrived.
+     * @param waiter Record, deleted by the last arrival.
+     */
+    static auto arm(std::unique_ptr<CombineWaiter> waiter) -> void
+    {
+        CombineWaiter* raw = waiter.release();
+        // when_any may move futures_ into its result while arming; the elements stay in place
+        Future<T>* futures = raw->futures_.data();
+        const size_t count = raw->futures_.size();
+        for (size_t i = 0; i < count; i++) {
+            Slot& slot = raw->slots_[i];
+            slot.on_ready = &CombineWaiter::on_ready;
+            slot.owner = raw;
+            slot.index = i;
+            if (!futures[i].add_waiter(&slot)) {
+                raw->arrive(i);
+            }
+        }
+        if constexpr (IsAny) {
+            if (count == 0) {
+                raw->setter_.set_value(WhenAnyResult<T>{.index = SIZE_MAX, .futures = {}});
+            }
+        }
+        raw->release();
+    }
+
+private:
+    /**
+     * @brief Waiter registered on one input.
+     */
+    struct Slot : EdgeWaiter {
+        CombineWaiter* owner = nullptr; ///< Record the slot belongs to
+        size_t index = 0;               ///< Position of the input
+    };
+
+    static auto on_ready(EdgeWaiter* waiter) -> void
+    {
+        Slot* slot = static_cast<Slot*>(waiter);
+        slot->owner->arrive(slot->index);
+    }
+
+    /**
+     * @brief Handles one ready input.
+     * @param index Position of the input.
+     */
+    auto arrive(size_t index) -> void
+    {
+        if constexpr (IsAny) {
+            if (!won_.exchange(true, std::memory_order_acq_rel)) {
+                setter_.set_value(WhenAnyResult<T>{.index = index, .futures = std::move(futures_)});
+            }
+        }
+        release();
+    }
+
+    /**
+     * @brief Drops one reference; the last one completes when_all() and deletes the record.
+     */
+    auto release() -> void
+    {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        if constexpr (!IsAny) {
+            complete_all();
+        }
+        delete this;
+    }
+
+    /**
+     * @brief Collects every value in input order, or forwards the first exception.
+     */
+    auto complete_all() -> void
+    {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                for (auto& future : futures_) {
+                    future.get();
+                }
+                setter_.set_value();
+            }
+            else {
+                std::vector<T> values;
+                values.reserve(futures_.size());
+                for (auto& future : futures_) {
+                    values.push_back(future.get());
+                }
+                setter_.set_value(std::move(values));
+            }
+        }
+        catch (...) {
+            setter_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    std::vector<Future<T>> futures_; ///< Inputs (moved into the result by when_any)
+    std::vector<Slot> slots_;        ///< One waiter per input
+    std::atomic<size_t> pending_;    ///< Inputs not arrived yet, plus one while arming
+    std::atomic<bool> won_{false};   ///< when_any: result already set
+    FutureSetter<R> setter_;         ///< Result
+};
+
+} // namespace detail
+
+/**
+ * @brief Combines futures into one that is ready when all of them are.
+ * @param futures Input futures (all valid).
+ * @return Future of the values in input order (void for void inputs), or of the
+ *         first exception in input order.
+ *
+ * @note Completes on the thread that makes the last input ready; no thread blocks.
+ */
+template<typename T>
+auto when_all(std::vector<Future<T>> futures) -> Future<WhenAllValue<T>>
+{
+    using R = WhenAllValue<T>;
+    IThreadPool* pool = futures.empty() ? nullptr : futures.front().get_pool();
+    auto* result = detail::FutureState<R>::create(pool, 2);
+    using Waiter = detail::CombineWaiter<T, R, false>;
+    Waiter::arm(std::make_unique<Waiter>(std::move(futures), result));
+    return Future<R>(result);
+}
+
+/**
+ * @brief Combines futures into one that is ready when the first of them is.
+ * @param futures Input futures (all valid).
+ * @return Future of the first ready index together with all input futures.
+ *
+ * @note The other inputs keep running; their futures are handed back in the result.
+ */
+template<typename T>
+auto when_any(std::vector<Future<T>> futures) -> Future<WhenAnyResult<T>>
+{
+    using R = WhenAnyResult<T>;
+    IThreadPool* pool = futures.empty() ? nullptr : futures.front().get_pool();
+    auto* result = detail::FutureState<R>::create(pool, 2);
+    using Waiter = detail::CombineWaiter<T, R, true>;
+    Waiter::arm(std::make_unique<Waiter>(std::move(futures), result));
+    return Future<R>(result);
+}
+
+} // namespace tw
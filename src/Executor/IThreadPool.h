@@ -0,0 +1,310 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "../TaskWeave/Metafunctions.h"
+#include "../TaskWeave/UniqueFunction.h"
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Priority lane of a task submitted to a thread pool.
+ *
+ * Pools with priority lanes (ThreadPool) always run the highest non-empty lane
+ * first, with starvation protection for the lower ones. Pools without lanes
+ * treat every priority as Normal.
+ */
+enum class TaskPriority : uint8_t {
+    High,      ///< Latency-critical work; jumps ahead of queued Normal and Background tasks
+    Normal,    ///< Default lane of add_task() and add_tasks()
+    Background ///< Bulk or maintenance work; runs when the other lanes are empty (or starving)
+};
+
+/// Number of TaskPriority lanes
+inline constexpr size_t kTaskPriorityCount = 3;
+
+/**
+ * @brief Interface class representing a pool of worker threads.
+ *
+ * IThreadPool is the extension point used by ThreadPoolExecutor to run tasks.
+ * It provides the callable submission front-end (add_task) and leaves queueing
+ * and worker management to the implementations.
+ *
+ * Implementations:
+ * - ThreadPool: single shared FIFO queue
+ * - WorkStealingThreadPool: per-worker lock-free deques with random-victim stealing
+ * - NumaThreadPool: one queue and worker group per NUMA node, stealing locally before remotely
+ */
+class IThreadPool {
+public:
+    /**
+     * @brief Type-erased unit of work stored by the pool implementations.
+     *
+     * Move-only with inline storage for a few pointers, so wrapping a typical
+     * lambda does not allocate.
+     */
+    using TaskFunction = UniqueFunction<void()>;
+
+public:
+    /**
+     * @brief Virtual destructor for polymorphic deletion.
+     */
+    virtual ~IThreadPool() = default;
+
+    /**
+     * @brief Submits a callable task to the execution queue.
+     *
+     * @tparam Fn Callable type (function pointer, lambda, std::function, etc.).
+     * @tparam Args Argument types to forward to the callable.
+     * @param fn Callable to execute.
+     * @param args Arguments to forward to the callable.
+     * @return true if task was successfully queued, false if fn is nullptr.
+     *
+     * @note Performs compile-time check to reject nullptr function pointers,
+     *       std::function and UniqueFunction objects. Other callable types bypass this check.
+     * @note A callable submitted without arguments is stored as-is (no extra wrapper).
+     * @note Thread-safe: synchronization is provided by the implementation.
+     */
+    template<typename Fn, typename... Args>
+    auto add_task(Fn&& fn, Args&&... args) -> bool
+    {
+        // Only check for nullptr if it's a function pointer or an std::function / UniqueFunction types
+        if constexpr (is_nullable_task_v<std::remove_cvref_t<Fn>>) {
+            if (fn == nullptr) {
+                return false;
+            }
+        }
+        enqueue(make_task_function(std::forward<Fn>(fn), std::forward<Args>(args)...));
+        return true;
+    }
+
+    /**
+     * @brief Submits a callable task to a priority lane.
+     *
+     * @tparam Fn Callable type (function pointer, lambda, std::function, etc.).
+     * @tparam Args Argument types to forward to the callable.
+     * @param priority Lane to queue the task in.
+     * @param fn Callable to execute.
+     * @param args Arguments to forward to the callable.
+     * @return true if task was successfully queued, false if fn is nullptr.
+     *
+     * @note Same checks and storage as add_task(fn, args...), which queues in the Normal lane.
+     * @note Thread-safe: synchronization is provided by the implementation.
+     */
+    template<typename Fn, typename... Args>
+    auto add_task(TaskPriority priority, Fn&& fn, Args&&... args) -> bool
+    {
+        if constexpr (is_nullable_task_v<std::remove_cvref_t<Fn>>) {
+            if (fn == nullptr) {
+                return false;
+            }
+        }
+        enqueue_with_priority(make_task_function(std::forward<Fn>(fn), std::forward<Args>(args)...), priority);
+        return true;
+    }
+
+    /**
+     * @brief Submits a callable task to the queue of a NUMA node.
+     *
+     * @tparam Fn Callable type (function pointer, lambda, std::function, etc.).
+     * @tparam Args Argument types to forward to the callable.
+     * @param node NUMA node whose workers should run the task (wraps around the pool's node count).
+     * @param fn Callable to execute.
+     * @param args Arguments to forward to the callable.
+     * @return true if task was successfully queued, false if fn is nullptr.
+     *
+     * @note Pools without NUMA nodes treat it as add_task(fn, args...).
+     * @note Thread-safe: synchronization is provided by the implementation.
+     */
+    template<typename Fn, typename... Args>
+    auto add_task_on_node(uint32_t node, Fn&& fn, Args&&... args) -> bool
+    {
+        if constexpr (is_nullable_task_v<std::remove_cvref_t<Fn>>) {
+            if (fn == nullptr) {
+                return false;
+            }
+        }
+        enqueue_on_node(make_task_function(std::forward<Fn>(fn), std::forward<Args>(args)...), node);
+        return true;
+    }
+
+    /**
+     * @brief Submits a whole range of callables in one batch.
+     *
+     * @tparam Range Input range whose elements are callables invocable with no arguments.
+     * @param tasks Callables to execute. Elements are moved from when the range yields rvalues.
+     * @return Number of tasks queued (null function pointers / std::function / UniqueFunction objects are skipped).
+     *
+     * Implementations enqueue the batch under a single synchronization round-trip
+     * and wake at most min(N, idle workers) threads.
+     *
+     * @note Thread-safe: synchronization is provided by the implementation.
+     */
+    template<std::ranges::input_range Range>
+    auto add_tasks(Range&& tasks) -> size_t
+    {
+        using Fn = std::ranges::range_value_t<Range>;
+
+        std::vector<TaskFunction> batch;
+        if constexpr (std::ranges::sized_range<Range>) {
+            batch.reserve(std::ranges::size(tasks));
+        }
+        for (auto&& fn : tasks) {
+            if constexpr (is_nullable_task_v<std::remove_cvref_t<Fn>>) {
+                if (fn == nullptr) {
+                    continue;
+                }
+            }
+            batch.emplace_back(std::forward<decltype(fn)>(fn));
+        }
+        if (!batch.empty()) {
+            enqueue_batch(batch);
+        }
+        return batch.size();
+    }
+
+    /**
+     * @brief Clears all pending tasks from the queue without executing them.
+     *
+     * Does not affect tasks currently in execution.
+     */
+    virtual auto clear_queued_tasks() -> void = 0;
+
+    /**
+     * @brief Spawns worker threads and begins task processing.
+     *
+     * @note Calling run() on a pool that is already running has no effect.
+     */
+    virtual auto run() noexcept -> void = 0;
+
+    /**
+     * @brief Blocks until all submitted tasks have completed execution.
+     */
+    virtual auto wait() const noexcept -> void = 0;
+
+    /**
+     * @brief Runs one queued task on the calling thread, if any.
+     * @return true if a task was executed, false if none was available.
+     *
+     * Lets a thread that waits for other tasks (e.g. TaskGroup::join) help
+     * instead of blocking. May be called from worker and non-worker threads.
+     */
+    virtual auto try_execute_one() -> bool = 0;
+
+    /**
+     * @brief Checks if the thread pool has no active tasks.
+     * @return true if no tasks are currently executing or queued.
+     */
+    virtual auto is_idle() const noexcept -> bool = 0;
+
+    /**
+     * @brief Returns the count of currently active tasks.
+     * @return Number of tasks being executed or waiting in queue.
+     */
+    virtual auto active_task_count() const noexcept -> int = 0;
+
+    /**
+     * @brief Checks if the task queue is empty.
+     * @return true if no tasks are waiting in the queue.
+     */
+    virtual auto empty() const noexcept -> bool = 0;
+
+    /**
+     * @brief Returns the number of tasks waiting in the queue.
+     * @return Count of pending tasks (not including executing tasks).
+     */
+    virtual auto size() const noexcept -> size_t = 0;
+
+    /**
+     * @brief Returns the configured number of worker threads.
+     * @return Thread count specified at construction.
+     */
+    virtual auto worker_count() const noexcept -> size_t = 0;
+
+protected:
+    /**
+     * @brief Whether a submitted callable type can be null and must be checked.
+     */
+    template<typename Fn>
+    static constexpr bool is_nullable_task_v =
+        std::is_pointer_v<Fn> || is_std_function_v<Fn> || is_unique_function_v<Fn>;
+
+    /**
+     * @brief Wraps a callable and its arguments into a TaskFunction.
+     * @param fn Callable to execute.
+     * @param args Arguments to forward to the callable.
+     * @return The callable as-is when there are no arguments, otherwise a capturing wrapper.
+     */
+    template<typename Fn, typename... Args>
+    static auto make_task_function(Fn&& fn, Args&&... args) -> TaskFunction
+    {
+        if constexpr (sizeof...(Args) == 0) {
+            return TaskFunction(std::forward<Fn>(fn));
+        }
+        else {
+            return TaskFunction([f = std::forward<Fn>(fn), ... captured_args = std::forward<Args>(args)]() mutable {
+                std::invoke(f, std::move(captured_args)...);
+            });
+        }
+    }
+
+    /**
+     * @brief Places a wrapped task into the implementation's queue.
+     * @param task Task to execute on a worker thread.
+     *
+     * Implementations must count the task as active before returning.
+     */
+    virtual auto enqueue(TaskFunction task) -> void = 0;
+
+    /**
+     * @brief Places a wrapped task into a priority lane of the implementation's queue.
+     * @param task Task to execute on a worker thread.
+     * @param priority Lane to queue the task in.
+     *
+     * The default implementation ignores the priority and calls enqueue().
+     */
+    virtual auto enqueue_with_priority(TaskFunction task, [[maybe_unused]] TaskPriority priority) -> void
+    {
+        enqueue(std::move(task));
+    }
+
+    /**
+     * @brief Places a wrapped task into the queue of a NUMA node.
+     * @param task Task to execute on a worker thread.
+     * @param node NUMA node whose workers should run the task.
+     *
+     * The default implementation ignores the node and calls enqueue().
+     */
+    virtual auto enqueue_on_node(TaskFunction task, [[maybe_unused]] uint32_t node) -> void
+    {
+        enqueue(std::move(task));
+    }
+
+    /**
+     * @brief Places a batch of wrapped tasks into the implementation's queue.
+     * @param tasks Non-empty span of tasks; elements are moved from.
+     *
+     * The default implementation enqueues one task at a time. Implementations
+     * should override it to take their queue lock once.
+     */
+    virtual auto enqueue_batch(std::span<TaskFunction> tasks) -> void
+    {
+        for (auto& task : tasks) {
+            enqueue(std::move(task));
+        }
+    }
+};
+
+} // namespace tw
@@ -0,0 +1,670 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "IThreadPool.h"
+#include "Topology.h"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tw {
+
+/**
+ * @brief Asks the kernel to place the pages of a memory range on a NUMA node.
+ * @param addr Page-aligned start of the range.
+ * @param size Length of the range in bytes.
+ * @param node NUMA node id.
+ * @return true if the policy was applied, false if the node does not exist or
+ *         the platform has no mbind().
+ *
+ * Uses the preferred policy: pages not touched yet are allocated on the node
+ * when first written, and fall back to other nodes if it runs out of memory.
+ */
+inline auto bind_memory_to_node(void* addr, size_t size, uint32_t node) noexcept -> bool
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int kMpolPreferred = 1;
+    constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask;
+    try {
+        mask.resize(node / kBitsPerWord + 1);
+    }
+    catch (const std::bad_alloc&) {
+        return false;
+    }
+    mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+    // The kernel reads maxnode - 1 bits
+    return syscall(SYS_mbind, addr, size, kMpolPreferred, mask.data(), mask.size() * kBitsPerWord + 1, 0) == 0;
+#else
+    (void)addr;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+}
+
+/**
+ * @brief Allocator placing its memory on one NUMA node.
+ * @tparam T Element type.
+ *
+ * Every allocation is a separate page-aligned mapping bound to the node with
+ * bind_memory_to_node(), so it suits large buffers such as the payload of an
+ * Edge<std::vector<T, NumaAllocator<T>>> consumed on that node, not small
+ * objects. Binding is best effort: on single-node machines or platforms
+ * without mbind() the memory is ordinary.
+ *
+ * Usage:
+ * @code
+ * std::vector<float, NumaAllocator<float>> samples(NumaAllocator<float>(1));
+ * samples.resize(1 << 20); // pages land on node 1 when first written
+ * @endcode
+ */
+template<typename T>
+class NumaAllocator {
+public:
+    using value_type = T;
+
+    /**
+     * @brief Creates an allocator for a node.
+     * @param node NUMA node id.
+     */
+    explicit NumaAllocator(uint32_t node) noexcept
+        : node_(node)
+    {
+    }
+
+    template<typename U>
+    NumaAllocator(const NumaAllocator<U>& other) noexcept
+        : node_(other.get_node())
+    {
+    }
+
+    /**
+     * @brief Allocates storage for count elements on the node.
+     * @param count Number of elements.
+     * @return Pointer to uninitialized storage.
+     * @throws std::bad_alloc if the mapping fails.
+     */
+    [[nodiscard]] auto allocate(size_t count) -> T*
+    {
+        const size_t bytes = count * sizeof(T);
+#if defined(__linux__)
+        void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        bind_memory_to_node(memory, bytes, node_);
+        return static_cast<T*>(memory);
+#else
+        return static_cast<T*>(::operator new(bytes, std::align_val_t{alignof(T)}));
+#endif
+    }
+
+    /**
+     * @brief Releases storage returned by allocate().
+     * @param memory Pointer returned by allocate().
+     * @param count Number of elements passed to allocate().
+     */
+    auto deallocate(T* memory, size_t count) noexcept -> void
+    {
+#if defined(__linux__)
+        munmap(memory, count * sizeof(T));
+#else
+        (void)count;
+        ::operator delete(memory, std::align_val_t{alignof(T)});
+#endif
+    }
+
+    /**
+     * @brief Returns the node the memory is placed on.
+     * @return NUMA node id.
+     */
+    auto get_node() const noexcept -> uint32_t
+    {
+        return node_;
+    }
+
+    template<typename U>
+    auto operator==(const NumaAllocator<U>& other) const noexcept -> bool
+    {
+        return node_ == other.get_node();
+    }
+
+private:
+    uint32_t node_; ///< NUMA node of the allocations
+};
+
+/**
+ * @brief Worker layout and stealing policy of a NumaThreadPool.
+ */
+struct NumaPoolOptions {
+    size_t threads_per_node = 0; ///< Workers per node (0 = one per CPU of the node)
+    bool pin_workers = true;     ///< Restrict each worker to the CPUs of its node
+    bool steal_remote = true;    ///< Let idle workers run tasks queued on other nodes
+};
+
+/**
+ * @brief A thread pool with one queue and one group of workers per NUMA node.
+ *
+ * NumaThreadPool keeps tasks, and the memory they touch, on one socket:
+ * - Each node of the CpuTopology gets a FIFO queue and threads_per_node
+ *   workers restricted to the node's CPUs, so the pages they first write are
+ *   allocated on that node
+ * - add_task_on_node() queues on a given node; ITask::set_numa_node() hints
+ *   make ThreadPoolExecutor use it, so producer and consumer share a socket
+ * - Tasks submitted from a worker stay on its node; tasks submitted from other
+ *   threads are spread over the nodes round-robin
+ * - A worker runs its own node's queue first, then, with steal_remote, the
+ *   other nodes' queues in index order; otherwise it parks on its node
+ *
+ * Any topology can be passed in, so the pool can be exercised on a
+ * single-node machine with a simulated one (and pin_workers off).
+ *
+ * Thread Safety:
+ * - Each node queue is protected by its own mutex; queued counts are atomic
+ * - Workers park on their node's condition variable; a submitter wakes an
+ *   idle worker of the target node, or of another node when stealing is on
+ *
+ * Usage:
+ * @code
+ * NumaThreadPool pool;                 // detected topology
+ * pool.run();
+ * pool.add_task_on_node(1, []{ <task logic> });
+ * pool.wait();
+ * @endcode
+ */
+class NumaThreadPool : public IThreadPool {
+public:
+    /**
+     * @brief Constructs a pool with one worker group per NUMA node of a topology.
+     * @param topology CPUs and nodes to use (CpuTopology::detect() by default).
+     * @param options Worker layout and stealing policy.
+     * @param on_complete_callback Optional callback invoked when all tasks complete.
+     */
+    explicit NumaThreadPool(const CpuTopology& topology = CpuTopology::detect(),
+                            const NumaPoolOptions& options = {},
+                            const std::function<void()>& on_complete_callback = nullptr)
+        : on_complete_(on_complete_callback)
+        , options_(options)
+    {
+        auto node_ids = topology.get_numa_nodes();
+        if (node_ids.empty()) {
+            node_ids.push_back(0);
+        }
+        for (uint32_t id : node_ids) {
+            auto node = std::make_unique<Node>();
+            node->id = id;
+            node->cpus = topology.get_node_cpus(id);
+            node->thread_count = options_.threads_per_node > 0 ? options_.threads_per_node
+                                                               : std::max<size_t>(node->cpus.size(), 1);
+            thread_count_ += node->thread_count;
+            nodes_.push_back(std::move(node));
+        }
+    }
+
+    /**
+     * @brief Destructor - initiates shutdown and joins all worker threads.
+     */
+    ~NumaThreadPool() override
+    {
+        is_shutting_down_.store(true, std::memory_order_seq_cst);
+        for (auto& node : nodes_) {
+            std::lock_guard lck{node->mtx};
+            node->cv.notify_all();
+        }
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    // Uncopyable class
+    NumaThreadPool(const NumaThreadPool&) = delete;
+    auto operator=(const NumaThreadPool&) -> NumaThreadPool& = delete;
+
+    // Unmovable class
+    NumaThreadPool(NumaThreadPool&& other) noexcept = delete;
+    auto operator=(NumaThreadPool&& other) noexcept -> NumaThreadPool& = delete;
+
+    /**
+     * @brief Returns the NUMA node of the calling worker.
+     * @return Node id if called from a NumaThreadPool worker, std::nullopt otherwise.
+     */
+    static auto current_node() noexcept -> std::optional<uint32_t>
+    {
+        if (current_pool_ == nullptr) {
+            return std::nullopt;
+        }
+        return current_pool_->nodes_[current_node_index_]->id;
+    }
+
+    /**
+     * @brief Clears all pending tasks from every node queue without executing them.
+     *
+     * Reduces active task count by the number of cleared tasks and wakes
+     * waiters if the pool became idle. Does not affect running tasks.
+     *
+     * @note Thread-safe: acquires each node lock in turn.
+     */
+    auto clear_queued_tasks() -> void override
+    {
+        size_t cleared = 0;
+        for (auto& node : nodes_) {
+            std::deque<TaskFunction> dropped;
+            {
+                std::lock_guard lck{node->mtx};
+                dropped.swap(node->tasks);
+                node->size.store(0, std::memory_order_seq_cst);
+            }
+            // Destroyed outside the lock: a destroyed task may submit a new one
+            cleared += dropped.size();
+        }
+        if (cleared > 0) {
+            complete_tasks(static_cast<int>(cleared));
+        }
+    }
+
+    /**
+     * @brief Spawns the worker groups and begins task processing.
+     *
+     * @note Not thread-safe: should be called once. Subsequent calls are no-ops.
+     */
+    auto run() noexcept -> void override
+    {
+        if (!workers_.empty()) {
+            return;
+        }
+        workers_.reserve(thread_count_);
+        for (size_t index = 0; index < nodes_.size(); index++) {
+            for (size_t i = 0; i < nodes_[index]->thread_count; i++) {
+                workers_.emplace_back([this, index]() {
+                    worker_loop(index);
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Blocks until all submitted tasks have completed execution.
+     *
+     * @note Thread-safe: uses dedicated wait mutex.
+     */
+    auto wait() const noexcept -> void override
+    {
+        std::unique_lock lck(wait_mtx_);
+        wait_cv_.wait(lck, [this]() {
+            return is_idle();
+        });
+    }
+
+    /**
+     * @brief Runs one queued task on the calling thread, if any.
+     * @return true if a task was executed.
+     *
+     * A worker looks at its own node first; other threads start at the next
+     * round-robin node. Every node is searched, whatever steal_remote says.
+     */
+    auto try_execute_one() -> bool override
+    {
+        const size_t start = current_pool_ == this ? current_node_index_ : next_node_index();
+        for (size_t d = 0; d < nodes_.size(); d++) {
+            if (TaskFunction task = pop((start + d) % nodes_.size())) {
+                task();
+                complete_tasks(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if the thread pool has no active tasks.
+     * @return true if no tasks are currently executing or queued.
+     *
+     * @note Lock-free: uses atomic load with acquire semantics.
+     */
+    auto is_idle() const noexcept -> bool override
+    {
+        return active_task_count_.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @brief Returns the count of currently active tasks.
+     * @return Number of tasks being executed or waiting in a queue.
+     */
+    auto active_task_count() const noexcept -> int override
+    {
+        return active_task_count_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if every node queue is empty.
+     * @return true if no tasks are waiting.
+     *
+     * @note Lock-free: uses atomic loads.
+     */
+    auto empty() const noexcept -> bool override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the number of tasks waiting in all node queues.
+     * @return Count of pending tasks (not including executing tasks).
+     *
+     * @note Lock-free: uses atomic loads.
+     */
+    auto size() const noexcept -> size_t override
+    {
+        size_t count = 0;
+        for (const auto& node : nodes_) {
+            count += node->size.load(std::memory_order_acquire);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the total number of worker threads.
+     * @return Sum of the workers of every node.
+     */
+    auto worker_count() const noexcept -> size_t override
+    {
+        return thread_count_;
+    }
+
+    /**
+     * @brief Returns the number of NUMA nodes.
+     * @return Node count (at least 1).
+     */
+    auto node_count() const noexcept -> size_t
+    {
+        return nodes_.size();
+    }
+
+    /**
+     * @brief Returns the ids of the NUMA nodes, in index order.
+     * @return Node ids.
+     */
+    auto get_node_ids() const -> std::vector<uint32_t>
+    {
+        std::vector<uint32_t> ids;
+        for (const auto& node : nodes_) {
+            ids.push_back(node->id);
+        }
+        return ids;
+    }
+
+protected:
+    /**
+     * @brief Queues a task on the calling worker's node, or the next round-robin node.
+     * @param task Task to execute on a worker thread.
+     */
+    auto enqueue(TaskFunction task) -> void override
+    {
+        push(current_pool_ == this ? current_node_index_ : next_node_index(), std::move(task));
+    }
+
+    /**
+     * @brief Queues a task on a NUMA node.
+     * @param task Task to execute on a worker thread.
+     * @param node Node id; ids not in the topology wrap around the node count.
+     */
+    auto enqueue_on_node(TaskFunction task, uint32_t node) -> void override
+    {
+        push(index_of(node), std::move(task));
+    }
+
+    /**
+     * @brief Queues a batch on the calling worker's node, or spreads it over the nodes.
+     * @param tasks Non-empty span of tasks; elements are moved from.
+     *
+     * @note Thread-safe: acquires each involved node lock once.
+     */
+    auto enqueue_batch(std::span<TaskFunction> tasks) -> void override
+    {
+        const bool is_local = current_pool_ == this;
+        const size_t start = is_local ? current_node_index_ : next_node_index();
+        // Task i goes to node start + i % parts
+        const size_t parts = is_local ? 1 : std::min(nodes_.size(), tasks.size());
+        active_task_count_.fetch_add(static_cast<int>(tasks.size()), std::memory_order_acq_rel);
+        for (size_t part = 0; part < parts; part++) {
+            const size_t index = (start + part) % nodes_.size();
+            Node& node = *nodes_[index];
+            size_t count = 0;
+            {
+                std::lock_guard lck{node.mtx};
+                for (size_t i = part; i < tasks.size(); i += parts) {
+                    node.tasks.push_back(std::move(tasks[i]));
+                    count++;
+                }
+                node.size.fetch_add(count, std::memory_order_seq_cst);
+            }
+            wake(index, count);
+        }
+    }
+
+private:
+    /**
+     * @brief Queue and worker group of one NUMA node.
+     */
+    struct Node {
+        uint32_t id = 0;                   ///< NUMA node id
+        std::vector<uint32_t> cpus;        ///< CPUs the workers are restricted to
+        size_t thread_count = 0;           ///< Workers of the node
+        std::mutex mtx;                    ///< Protects tasks and idle_count
+        std::condition_variable cv;        ///< Parked workers of the node
+        std::deque<TaskFunction> tasks;    ///< Pending tasks, FIFO
+        std::atomic<size_t> size{0};       ///< tasks.size(), readable without the lock
+        size_t idle_count = 0;             ///< Workers parked on cv
+    };
+
+    /**
+     * @brief Maps a node id to its index.
+     * @param node Node id.
+     * @return Index of the node, or node modulo the node count for unknown ids.
+     */
+    auto index_of(uint32_t node) const noexcept -> size_t
+    {
+        for (size_t index = 0; index < nodes_.size(); index++) {
+            if (nodes_[index]->id == node) {
+                return index;
+            }
+        }
+        return node % nodes_.size();
+    }
+
+    /**
+     * @brief Returns the node that receives the next task submitted from outside the pool.
+     * @return Node index, round-robin.
+     */
+    auto next_node_index() noexcept -> size_t
+    {
+        return next_node_.fetch_add(1, std::memory_order_relaxed) % nodes_.size();
+    }
+
+    /**
+     * @brief Queues one task on a node and wakes a worker for it.
+     * @param index Node index.
+     * @param task Task to execute.
+     */
+    auto push(size_t index, TaskFunction task) -> void
+    {
+        Node& node = *nodes_[index];
+        active_task_count_.fetch_add(1, std::memory_order_acq_rel);
+        {
+            std::lock_guard lck{node.mtx};
+            node.tasks.push_back(std::move(task));
+            node.size.fetch_add(1, std::memory_order_seq_cst);
+        }
+        wake(index, 1);
+    }
+
+    /**
+     * @brief Wakes workers for tasks just queued on a node.
+     * @param index Node index.
+     * @param count Number of tasks queued.
+     *
+     * Wakes idle workers of the node first; with steal_remote, the rest go to
+     * idle workers of the other nodes in index order. A worker counts itself
+     * idle under its node lock before re-checking the queues, and the queued
+     * count is published before the idle counts are read under the same
+     * locks, so a task cannot be left without a worker.
+     */
+    auto wake(size_t index, size_t count) -> void
+    {
+        const size_t node_count = options_.steal_remote ? nodes_.size() : 1;
+        for (size_t d = 0; d < node_count && count > 0; d++) {
+            Node& node = *nodes_[(index + d) % nodes_.size()];
+            std::lock_guard lck{node.mtx};
+            const size_t woken = std::min(count, node.idle_count);
+            if (woken == node.idle_count && woken > 0) {
+                node.cv.notify_all();
+            }
+            else {
+                for (size_t i = 0; i < woken; i++) {
+                    node.cv.notify_one();
+                }
+            }
+            count -= woken;
+        }
+    }
+
+    /**
+     * @brief Pops the front task of a node queue.
+     * @param index Node index.
+     * @return The task, or an empty TaskFunction if the queue is empty.
+     */
+    auto pop(size_t index) -> TaskFunction
+    {
+        Node& node = *nodes_[index];
+        if (node.size.load(std::memory_order_acquire) == 0) {
+            return {};
+        }
+        std::lock_guard lck{node.mtx};
+        if (node.tasks.empty()) {
+            return {};
+        }
+        TaskFunction task = std::move(node.tasks.front());
+        node.tasks.pop_front();
+        node.size.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    /**
+     * @brief Pops a task for a worker: own node first, then the others if stealing.
+     * @param index Node index of the worker.
+     * @return The task, or an empty TaskFunction if nothing is available.
+     */
+    auto take(size_t index) -> TaskFunction
+    {
+        const size_t node_count = options_.steal_remote ? nodes_.size() : 1;
+        for (size_t d = 0; d < node_count; d++) {
+            if (TaskFunction task = pop((index + d) % nodes_.size())) {
+                return task;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Checks whether a worker of a node has something to run.
+     * @param index Node index of the worker.
+     * @return true if its queue (or, with steal_remote, any queue) is non-empty.
+     */
+    auto has_work(size_t index) const noexcept -> bool
+    {
+        if (!options_.steal_remote) {
+            return nodes_[index]->size.load(std::memory_order_seq_cst) > 0;
+        }
+        return std::ranges::any_of(nodes_, [](const auto& node) {
+            return node->size.load(std::memory_order_seq_cst) > 0;
+        });
+    }
+
+    /**
+     * @brief Worker thread of a node: runs tasks until shutdown.
+     * @param index Node index of the worker.
+     */
+    auto worker_loop(size_t index) -> void
+    {
+        current_pool_ = this;
+        current_node_index_ = index;
+        Node& node = *nodes_[index];
+        if (options_.pin_workers) {
+            set_thread_affinity(node.cpus);
+        }
+        while (true) {
+            if (TaskFunction task = take(index)) {
+                task();
+                complete_tasks(1);
+                continue;
+            }
+            std::unique_lock lck{node.mtx};
+            node.idle_count++;
+            node.cv.wait(lck, [this, index]() {
+                return is_shutting_down_.load(std::memory_order_seq_cst) || has_work(index);
+            });
+            node.idle_count--;
+            if (is_shutting_down_.load(std::memory_order_seq_cst)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Decrements the active count and notifies waiters on reaching zero.
+     * @param count Number of tasks that finished or were discarded.
+     */
+    auto complete_tasks(int count) -> void
+    {
+        if (active_task_count_.fetch_sub(count, std::memory_order_acq_rel) != count) {
+            return;
+        }
+        std::lock_guard lck{wait_mtx_};
+        if (on_complete_) {
+            on_complete_();
+        }
+        wait_cv_.notify_all();
+    }
+
+private:
+    static inline thread_local NumaThreadPool* current_pool_ = nullptr; ///< Pool owning the calling worker
+    static inline thread_local size_t current_node_index_ = 0;          ///< Node index of the calling worker
+
+    std::vector<std::unique_ptr<Node>> nodes_; ///< One queue and worker group per NUMA node
+    std::vector<std::thread> workers_;         ///< Worker thread handles, grouped by node
+    std::function<void()> on_complete_;        ///< Callback when all tasks complete
+    NumaPoolOptions options_;                  ///< Worker layout and stealing policy
+    size_t thread_count_ = 0;                  ///< Workers of all nodes
+    std::atomic<size_t> next_node_{0};         ///< Round-robin cursor for external submissions
+    std::atomic<int> active_task_count_{0};    ///< Count of active/pending tasks
+    std::atomic<bool> is_shutting_down_{false}; ///< Shutdown flag
+    mutable std::mutex wait_mtx_;              ///< Protects wait condition
+    mutable std::condition_variable wait_cv_;  ///< Notifies waiters when idle
+};
+
+} // namespace tw
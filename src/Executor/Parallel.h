@@ -0,0 +1,440 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "IThreadPool.h"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief How a parallel loop splits its index range among the participating threads.
+ */
+enum class Partitioner {
+    Static,  ///< One equal chunk per participant (at least grain_size); lowest overhead for uniform bodies
+    Guided,  ///< Chunks of remaining / (2 * participants), shrinking towards grain_size; for mildly uneven bodies
+    Adaptive ///< Lazy binary splitting: a range is halved only while another participant is idle
+};
+
+/**
+ * @brief Options of parallel_for() and parallel_reduce().
+ */
+struct ParallelOptions {
+    Partitioner partitioner = Partitioner::Adaptive; ///< Range splitting strategy
+    size_t grain_size = 0; ///< Smallest chunk handed to the body; 0 picks range / (16 * participants)
+};
+
+namespace detail {
+
+/**
+ * @brief Shared state of one parallel loop: the unclaimed part of the index range and completion accounting.
+ *
+ * The calling thread and up to worker_count() helper jobs on the pool are the
+ * participants. They claim chunks from this state (a shared cursor for Static and
+ * Guided, a stack of split-off ranges for Adaptive) and run them through the
+ * process callable, so no job or Task is created per chunk. Helper jobs only add
+ * hands: the caller claims whatever the helpers do not, so the loop completes
+ * even if no helper ever gets a worker (a busy pool, or a call from the pool's
+ * only worker).
+ *
+ * The state is shared with the helper jobs because a helper may start after the
+ * loop returned; it then finds nothing to claim and never touches process.
+ *
+ * @tparam Index Integral index type.
+ * @tparam Process Callable invoked as process(first, last) for each claimed chunk.
+ */
+template<std::integral Index, typename Process>
+class ParallelLoop {
+public:
+    /**
+     * @brief Creates the state for [first, last).
+     * @param first First index.
+     * @param last One past the last index.
+     * @param process Chunk callable. Must outlive the loop.
+     * @param options Partitioner and grain size.
+     * @param participants Number of threads that will take part, including the caller.
+     */
+    ParallelLoop(Index first, Index last, Process& process, const ParallelOptions& options, size_t participants)
+        : first_(first)
+        , count_(static_cast<size_t>(last - first))
+        , process_(&process)
+        , partitioner_(options.partitioner)
+        , participants_(participants)
+        , grain_(options.grain_size != 0 ? options.grain_size : std::max<size_t>(1, count_ / (16 * participants)))
+        , remaining_(count_)
+        , splittable_(partitioner_ == Partitioner::Adaptive ? count_ : 0)
+    {
+        if (partitioner_ == Partitioner::Adaptive) {
+            ranges_.emplace_back(0, count_);
+        }
+    }
+
+    // Uncopyable class
+    ParallelLoop(const ParallelLoop&) = delete;
+    auto operator=(const ParallelLoop&) -> ParallelLoop& = delete;
+
+    // Unmovable class
+    ParallelLoop(ParallelLoop&&) = delete;
+    auto operator=(ParallelLoop&&) -> ParallelLoop& = delete;
+
+    /**
+     * @brief Returns the effective grain size.
+     * @return Smallest chunk handed to process.
+     */
+    auto get_grain_size() const noexcept -> size_t
+    {
+        return grain_;
+    }
+
+    /**
+     * @brief Claims and processes chunks until none is left to claim.
+     *
+     * Run by every helper job. With the Adaptive partitioner a participant that
+     * finds nothing stays hungry while some range can still be split, so that
+     * busy participants split their ranges for it; it returns once only the
+     * last chunks of the owned ranges are left.
+     */
+    auto participate() -> void
+    {
+        if (partitioner_ == Partitioner::Adaptive) {
+            participate_adaptive();
+        }
+        else {
+            size_t begin = 0;
+            size_t end = 0;
+            while (claim(begin, end)) {
+                run_chunk(begin, end);
+                complete(end - begin);
+            }
+        }
+    }
+
+    /**
+     * @brief Participates, then blocks until every claimed chunk has completed.
+     *
+     * Run by the calling thread. Rethrows the first exception thrown by process.
+     */
+    auto participate_and_wait() -> void
+    {
+        participate();
+        for (size_t remaining = remaining_.load(std::memory_order_acquire); remaining != 0;
+             remaining = remaining_.load(std::memory_order_acquire)) {
+            remaining_.wait(remaining, std::memory_order_acquire);
+        }
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    /**
+     * @brief Claims the next chunk from the shared cursor (Static and Guided).
+     * @param begin Receives the chunk's first offset.
+     * @param end Receives the chunk's end offset.
+     * @return false once the cursor has passed the end of the range.
+     */
+    auto claim(size_t& begin, size_t& end) -> bool
+    {
+        size_t next = next_.load(std::memory_order_relaxed);
+        while (next < count_) {
+            const size_t remaining = count_ - next;
+            size_t chunk = partitioner_ == Partitioner::Static ? (count_ + participants_ - 1) / participants_
+                                                               : remaining / (2 * participants_);
+            chunk = std::min(std::max(chunk, grain_), remaining);
+            if (next_.compare_exchange_weak(next, next + chunk, std::memory_order_relaxed)) {
+                begin = next;
+                end = next + chunk;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Adaptive participation: process owned ranges grain by grain, splitting them for hungry participants.
+     */
+    auto participate_adaptive() -> void
+    {
+        while (true) {
+            auto range = pop_range();
+            if (!range) {
+                hungry_.fetch_add(1, std::memory_order_relaxed);
+                while (!(range = pop_range()) && splittable_.load(std::memory_order_acquire) != 0) {
+                    std::this_thread::yield();
+                }
+                hungry_.fetch_sub(1, std::memory_order_relaxed);
+                if (!range) {
+                    return;
+                }
+            }
+
+            auto [begin, end] = *range;
+            const size_t owned = end - begin;
+            bool is_settled = false;
+            while (begin < end) {
+                // At most one split per chunk, so one hungry participant does not trigger a cascade
+                if (end - begin > grain_ && hungry_.load(std::memory_order_relaxed) > 0) {
+                    const size_t middle = begin + (end - begin) / 2;
+                    push_range(middle, end);
+                    end = middle;
+                }
+                const size_t chunk_end = std::min(begin + grain_, end);
+                if (!is_settled) {
+                    // A rest of at most one grain is never split: none of [begin, end) is left for others
+                    is_settled = end - chunk_end <= grain_;
+                    splittable_.fetch_sub(is_settled ? end - begin : chunk_end - begin, std::memory_order_acq_rel);
+                }
+                run_chunk(begin, chunk_end);
+                begin = chunk_end;
+            }
+            // Split-off halves are completed by whoever pops them
+            complete(owned - (range->second - end));
+        }
+    }
+
+    /**
+     * @brief Runs process on a chunk unless a previous chunk has failed.
+     * @param begin First offset.
+     * @param end End offset.
+     */
+    auto run_chunk(size_t begin, size_t end) -> void
+    {
+        if (failed_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        try {
+            (*process_)(static_cast<Index>(first_ + static_cast<Index>(begin)),
+                        static_cast<Index>(first_ + static_cast<Index>(end)));
+        }
+        catch (...) {
+            std::scoped_lock lck{ranges_mtx_};
+            if (!failed_.exchange(true, std::memory_order_relaxed)) {
+                error_ = std::current_exception();
+            }
+        }
+    }
+
+    /**
+     * @brief Accounts processed indices and wakes the caller once none remain.
+     * @param count Number of indices completed.
+     */
+    auto complete(size_t count) -> void
+    {
+        if (count != 0 && remaining_.fetch_sub(count, std::memory_order_acq_rel) == count) {
+            remaining_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Pops a split-off range.
+     * @return Range offsets, or std::nullopt if none is available.
+     */
+    auto pop_range() -> std::optional<std::pair<size_t, size_t>>
+    {
+        std::scoped_lock lck{ranges_mtx_};
+        if (ranges_.empty()) {
+            return std::nullopt;
+        }
+        auto range = ranges_.back();
+        ranges_.pop_back();
+        return range;
+    }
+
+    /**
+     * @brief Publishes a split-off range for a hungry participant.
+     * @param begin First offset.
+     * @param end End offset.
+     */
+    auto push_range(size_t begin, size_t end) -> void
+    {
+        std::scoped_lock lck{ranges_mtx_};
+        ranges_.emplace_back(begin, end);
+    }
+
+private:
+    const Index first_;             ///< First index of the loop
+    const size_t count_;            ///< Number of indices in the loop
+    Process* const process_;        ///< Chunk callable, owned by the caller
+    const Partitioner partitioner_; ///< Range splitting strategy
+    const size_t participants_;     ///< Threads taking part, including the caller
+    const size_t grain_;            ///< Smallest chunk handed to process
+
+    std::atomic<size_t> next_{0};     ///< Shared cursor of Static and Guided, as an offset from first_
+    std::atomic<size_t> remaining_;   ///< Indices not yet completed; the caller waits for zero
+    std::atomic<size_t> splittable_;  ///< Adaptive indices not yet started that may still be split or popped
+    std::atomic<size_t> hungry_{0};   ///< Adaptive participants waiting for a range
+    std::atomic<bool> failed_{false}; ///< Set by the first chunk that throws
+
+    std::mutex ranges_mtx_;                         ///< Guards ranges_ and error_
+    std::vector<std::pair<size_t, size_t>> ranges_; ///< Adaptive ranges not yet claimed
+    std::exception_ptr error_;                      ///< First exception thrown by process
+};
+
+/**
+ * @brief Runs a loop over [first, last) on the caller and on helper jobs of the pool.
+ * @param pool Thread pool providing the helpers.
+ * @param first First index.
+ * @param last One past the last index.
+ * @param process Chunk callable invoked as process(chunk_first, chunk_last).
+ * @param options Partitioner and grain size.
+ */
+template<std::integral Index, typename Process>
+auto run_parallel_loop(IThreadPool& pool, Index first, Index last, Process& process, const ParallelOptions& options)
+    -> void
+{
+    if (!(first < last)) {
+        return;
+    }
+    const size_t count = static_cast<size_t>(last - first);
+    const size_t participants = pool.worker_count() + 1;
+    auto loop = std::make_shared<ParallelLoop<Index, Process>>(first, last, process, options, participants);
+
+    const size_t chunks = (count + loop->get_grain_size() - 1) / loop->get_grain_size();
+    const size_t helpers = std::min(pool.worker_count(), chunks - 1);
+    if (helpers != 0) {
+        auto helper = [loop]() {
+            loop->participate();
+        };
+        pool.add_tasks(std::vector<decltype(helper)>(helpers, helper));
+    }
+    loop->participate_and_wait();
+}
+
+} // namespace detail
+
+/**
+ * @brief Runs body for every index of [first, last) on the calling thread and the pool's workers.
+ *
+ * The range is split according to options.partitioner and the chunks run
+ * directly from a shared loop state; no Task, Node or per-chunk pool job is
+ * created. At most worker_count() helper jobs are submitted, and the calling
+ * thread takes part, so the call also completes from inside a pool worker or
+ * while the pool is busy. Returns once every index has been processed.
+ *
+ * @tparam Index Integral index type.
+ * @tparam Body Callable invoked as body(i), or as body(chunk_first, chunk_last) for a whole chunk.
+ * @param pool Thread pool providing helper workers (must be running to contribute).
+ * @param first First index.
+ * @param last One past the last index.
+ * @param body Loop body.
+ * @param options Partitioner and grain size.
+ *
+ * @note The first exception thrown by body is rethrown after the remaining chunks are skipped.
+ *
+ * Usage:
+ * @code
+ * parallel_for(pool, size_t{0}, values.size(), [&](size_t i) { values[i] *= 2; });
+ * @endcode
+ */
+template<std::integral Index, typename Body>
+auto parallel_for(IThreadPool& pool, Index first, Index last, Body&& body, const ParallelOptions& options = {})
+    -> void
+{
+    auto process = [&body](Index chunk_first, Index chunk_last) {
+        if constexpr (std::is_invocable_v<Body&, Index, Index>) {
+            body(chunk_first, chunk_last);
+        }
+        else {
+            for (Index i = chunk_first; i < chunk_last; i++) {
+                body(i);
+            }
+        }
+    };
+    detail::run_parallel_loop(pool, first, last, process, options);
+}
+
+/**
+ * @brief Runs body for every element of a random-access range on the calling thread and the pool's workers.
+ *
+ * @tparam Range Sized random-access range.
+ * @tparam Body Callable invoked with a reference to each element.
+ * @param pool Thread pool providing helper workers.
+ * @param range Elements to process. Must outlive the call.
+ * @param body Loop body.
+ * @param options Partitioner and grain size.
+ */
+template<std::ranges::random_access_range Range, typename Body>
+    requires std::ranges::sized_range<Range>
+auto parallel_for(IThreadPool& pool, Range&& range, Body&& body, const ParallelOptions& options = {}) -> void
+{
+    auto begin = std::ranges::begin(range);
+    using Difference = std::ranges::range_difference_t<Range>;
+    parallel_for(
+        pool, Difference{0}, static_cast<Difference>(std::ranges::size(range)),
+        [&begin, &body](Difference chunk_first, Difference chunk_last) {
+            for (auto it = begin + chunk_first, end = begin + chunk_last; it != end; ++it) {
+                body(*it);
+            }
+        },
+        options);
+}
+
+/**
+ * @brief Reduces the indices of [first, last) in parallel.
+ *
+ * Each chunk is reduced starting from identity, and the per-chunk results are
+ * folded together with combine. Chunks are combined in completion order, so
+ * combine must be associative and commutative.
+ *
+ * @tparam Index Integral index type.
+ * @tparam T Result type.
+ * @tparam Body Either body(chunk_first, chunk_last, T init) -> T, reducing a whole chunk,
+ *         or body(i) -> T, mapping one index whose results are folded with combine.
+ * @tparam Combine Callable combine(T, T) -> T.
+ * @param pool Thread pool providing helper workers.
+ * @param first First index.
+ * @param last One past the last index.
+ * @param identity Neutral element of combine.
+ * @param body Chunk reducer or element mapping.
+ * @param combine Binary reduction.
+ * @param options Partitioner and grain size.
+ * @return identity combined with every chunk result.
+ *
+ * @note The first exception thrown by body or combine is rethrown.
+ *
+ * Usage:
+ * @code
+ * double sum = parallel_reduce(pool, size_t{0}, values.size(), 0.0,
+ *                              [&](size_t i) { return values[i]; }, std::plus<>{});
+ * @endcode
+ */
+template<std::integral Index, typename T, typename Body, typename Combine>
+auto parallel_reduce(IThreadPool& pool, Index first, Index last, T identity, Body&& body, Combine&& combine,
+                     const ParallelOptions& options = {}) -> T
+{
+    T result = identity;
+    std::mutex result_mtx;
+    auto process = [&](Index chunk_first, Index chunk_last) {
+        T partial = identity;
+        if constexpr (std::is_invocable_r_v<T, Body&, Index, Index, T>) {
+            partial = body(chunk_first, chunk_last, std::move(partial));
+        }
+        else {
+            for (Index i = chunk_first; i < chunk_last; i++) {
+                partial = combine(std::move(partial), body(i));
+            }
+        }
+        std::scoped_lock lck{result_mtx};
+        result = combine(std::move(result), std::move(partial));
+    };
+    detail::run_parallel_loop(pool, first, last, process, options);
+    return result;
+}
+
+} // namespace tw
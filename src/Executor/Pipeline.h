@@ -0,0 +1,469 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "IThreadPool.h"
+
+// STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief How a pipeline stage processes tokens.
+ */
+enum class StageMode {
+    SerialInOrder, ///< One token at a time, in the order the source produced them
+    Parallel       ///< Any number of tokens at once, in any order
+};
+
+/**
+ * @brief One stage of a pipeline.
+ *
+ * The first stage is the source, invoked as fn(FlowControl&) and returning the
+ * next item. Every other stage is invoked with the previous stage's output as an
+ * rvalue; the last stage usually returns void.
+ *
+ * @tparam Fn Stage callable.
+ */
+template<typename Fn>
+struct PipelineStage {
+    StageMode mode; ///< Serial in order, or parallel
+    Fn fn;          ///< Stage callable
+};
+
+/**
+ * @brief Lets the source stage end the stream.
+ */
+class FlowControl {
+public:
+    /**
+     * @brief Ends the stream; the value returned by the current source call is discarded.
+     */
+    auto stop() noexcept -> void
+    {
+        stopped_.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether the stream has ended.
+     * @return true after stop() was called or a stage threw.
+     */
+    auto is_stopped() const noexcept -> bool
+    {
+        return stopped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> stopped_{false}; ///< Set by stop()
+};
+
+namespace detail {
+
+/**
+ * @brief Storable form of a stage output: void becomes std::monostate.
+ */
+template<typename T>
+using StageValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+/**
+ * @brief Output types of a chain of stages, given the input of the first one.
+ */
+template<typename In, typename... Stages>
+struct StageOutputs {
+    using type = std::tuple<>;
+};
+
+template<typename In, typename Stage, typename... Rest>
+struct StageOutputs<In, Stage, Rest...> {
+    using Out = std::invoke_result_t<decltype(Stage::fn)&, In>;
+    using RestOutputs = typename StageOutputs<std::add_rvalue_reference_t<Out>, Rest...>::type;
+    using type = decltype(std::tuple_cat(std::declval<std::tuple<Out>>(), std::declval<RestOutputs>()));
+};
+
+/**
+ * @brief One run of a pipeline: token slots, per-stage ordering state and completion accounting.
+ *
+ * Token t lives in slot t % max_tokens from the source until it leaves the last
+ * stage. The source only produces token t once token t - max_tokens has left, so
+ * at most max_tokens tokens are in flight and their sequence numbers span fewer
+ * than max_tokens values. Every serial stage therefore has a ring of max_tokens
+ * entries, indexed like the slots, holding tokens that arrived before their turn.
+ *
+ * A token travels through consecutive stages on one pool job. At a serial stage
+ * it either enters (when it is the next in order and the stage is free) or is
+ * parked in the ring; the token leaving the stage hands the stage to the next
+ * parked token and submits a job for it. The source also runs as one job per
+ * token: each call produces a token, submits the next source call, and carries
+ * the new token onwards.
+ *
+ * @tparam Stages PipelineStage types, source first.
+ */
+template<typename... Stages>
+class PipelineRun {
+    static constexpr size_t kStageCount = sizeof...(Stages);
+    using Outputs = typename StageOutputs<FlowControl&, Stages...>::type;
+
+    template<size_t K>
+    using Output = std::tuple_element_t<K, Outputs>;
+
+    template<typename Sequence>
+    struct ValueOf;
+
+    template<size_t... Ks>
+    struct ValueOf<std::index_sequence<Ks...>> {
+        using type = std::variant<std::monostate, StageValue<Output<Ks>>...>;
+    };
+
+    /// Token payload; alternative K + 1 holds the output of stage K
+    using Value = typename ValueOf<std::make_index_sequence<kStageCount>>::type;
+
+    static_assert(kStageCount >= 1, "a pipeline needs at least a source stage");
+    static_assert(!std::is_void_v<Output<0>>, "the source stage must return the item it produced");
+
+public:
+    /**
+     * @brief Prepares a run.
+     * @param pool Thread pool running the stages.
+     * @param max_tokens Maximum number of tokens in flight (at least 1).
+     * @param stages Pipeline stages, source first.
+     */
+    PipelineRun(IThreadPool& pool, size_t max_tokens, Stages&... stages)
+        : pool_(pool)
+        , max_tokens_(std::max<size_t>(max_tokens, 1))
+        , stages_(stages...)
+        , modes_{stages.mode...}
+        , slots_(max_tokens_)
+        , slot_busy_(max_tokens_, 0)
+    {
+        for (auto& serial : serial_) {
+            serial.parked.assign(max_tokens_, 0);
+        }
+    }
+
+    // Uncopyable class
+    PipelineRun(const PipelineRun&) = delete;
+    auto operator=(const PipelineRun&) -> PipelineRun& = delete;
+
+    // Unmovable class
+    PipelineRun(PipelineRun&&) = delete;
+    auto operator=(PipelineRun&&) -> PipelineRun& = delete;
+
+    /**
+     * @brief Runs the pipeline until the source stops and every token has left.
+     *
+     * The calling thread executes queued pool jobs while waiting, so the run also
+     * completes from inside a worker or on a pool that is not running.
+     * Rethrows the first exception thrown by a stage.
+     */
+    auto run() -> void
+    {
+        active_.store(1, std::memory_order_relaxed);
+        submit_source();
+        while (active_.load(std::memory_order_acquire) != 0) {
+            if (!pool_.try_execute_one()) {
+                std::this_thread::yield();
+            }
+        }
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    /**
+     * @brief Ordering state of one serial stage.
+     */
+    struct SerialState {
+        std::mutex mtx;              ///< Guards the members below
+        size_t next_seq = 0;         ///< Sequence number allowed to enter next
+        bool busy = false;           ///< A token is inside the stage (or handed over to one)
+        std::vector<uint8_t> parked; ///< Ring of tokens waiting for their turn, indexed by slot
+    };
+
+    /**
+     * @brief A token slot.
+     */
+    struct Slot {
+        size_t seq = 0; ///< Sequence number of the token in the slot
+        Value value;    ///< Output of the last stage the token went through
+    };
+
+    /**
+     * @brief Submits one source call.
+     */
+    auto submit_source() -> void
+    {
+        pool_.add_task([this]() {
+            source_step();
+        });
+    }
+
+    /**
+     * @brief Produces one token, submits the next source call and carries the token through the stages.
+     */
+    auto source_step() -> void
+    {
+        const size_t seq = source_seq_;
+        const size_t slot_index = seq % max_tokens_;
+        {
+            std::scoped_lock lck{source_mtx_};
+            if (slot_busy_[slot_index] != 0) {
+                // Token seq - max_tokens is still in flight; it resubmits the source when it leaves
+                source_waiting_ = true;
+                return;
+            }
+            slot_busy_[slot_index] = 1;
+        }
+
+        Slot& slot = slots_[slot_index];
+        if (!flow_.is_stopped()) {
+            run_stage(0, slot);
+        }
+        if (flow_.is_stopped()) {
+            slot.value.template emplace<0>();
+            {
+                std::scoped_lock lck{source_mtx_};
+                slot_busy_[slot_index] = 0;
+            }
+            active_.fetch_sub(1, std::memory_order_acq_rel);
+            return;
+        }
+
+        slot.seq = seq;
+        source_seq_ = seq + 1;
+        active_.fetch_add(1, std::memory_order_relaxed);
+        submit_source();
+        advance(seq, 1, false);
+    }
+
+    /**
+     * @brief Carries a token through the stages from the given one until it is parked or leaves.
+     * @param seq Sequence number of the token.
+     * @param stage First stage to run.
+     * @param entered Whether the token has already entered stage (handed over by its predecessor).
+     */
+    auto advance(size_t seq, size_t stage, bool entered) -> void
+    {
+        Slot& slot = slots_[seq % max_tokens_];
+        for (; stage < kStageCount; stage++) {
+            if (modes_[stage] == StageMode::Parallel) {
+                run_stage(stage, slot);
+                continue;
+            }
+            if (!entered && !try_enter(stage, seq)) {
+                return;
+            }
+            entered = false;
+            run_stage(stage, slot);
+            leave(stage);
+        }
+        finish_token(seq);
+    }
+
+    /**
+     * @brief Enters a serial stage if it is the token's turn, otherwise parks the token.
+     * @param stage Serial stage.
+     * @param seq Sequence number of the token.
+     * @return true if the token entered the stage.
+     */
+    auto try_enter(size_t stage, size_t seq) -> bool
+    {
+        SerialState& serial = serial_[stage];
+        std::scoped_lock lck{serial.mtx};
+        if (!serial.busy && serial.next_seq == seq) {
+            serial.busy = true;
+            return true;
+        }
+        serial.parked[seq % max_tokens_] = 1;
+        return false;
+    }
+
+    /**
+     * @brief Leaves a serial stage and hands it to the next token if that one is parked.
+     * @param stage Serial stage.
+     */
+    auto leave(size_t stage) -> void
+    {
+        SerialState& serial = serial_[stage];
+        size_t handed_to = 0;
+        bool hand_over = false;
+        {
+            std::scoped_lock lck{serial.mtx};
+            serial.next_seq++;
+            auto& parked = serial.parked[serial.next_seq % max_tokens_];
+            if (parked != 0) {
+                parked = 0;
+                hand_over = true;
+                handed_to = serial.next_seq;
+            }
+            else {
+                serial.busy = false;
+            }
+        }
+        if (hand_over) {
+            pool_.add_task([this, handed_to, stage]() {
+                advance(handed_to, stage, true);
+            });
+        }
+    }
+
+    /**
+     * @brief Releases a token's slot, resubmitting the source if it waits for that slot.
+     * @param seq Sequence number of the token.
+     *
+     * @note The decrement of active_ is the token's last access to the run.
+     */
+    auto finish_token(size_t seq) -> void
+    {
+        const size_t slot_index = seq % max_tokens_;
+        slots_[slot_index].value.template emplace<0>();
+        bool resume_source = false;
+        {
+            std::scoped_lock lck{source_mtx_};
+            slot_busy_[slot_index] = 0;
+            if (source_waiting_ && source_seq_ % max_tokens_ == slot_index) {
+                source_waiting_ = false;
+                resume_source = true;
+            }
+        }
+        if (resume_source) {
+            submit_source();
+        }
+        active_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Runs one stage on a token, unless a stage has already failed.
+     * @param stage Stage index.
+     * @param slot Token slot.
+     *
+     * After a failure the source stops and in-flight tokens pass the remaining
+     * stages without running them, so serial stages still advance in order.
+     */
+    auto run_stage(size_t stage, Slot& slot) -> void
+    {
+        if (failed_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        static constexpr auto kStageRunners = make_stage_runners(std::make_index_sequence<kStageCount>{});
+        try {
+            (this->*kStageRunners[stage])(slot);
+        }
+        catch (...) {
+            std::scoped_lock lck{source_mtx_};
+            if (!failed_.exchange(true, std::memory_order_relaxed)) {
+                error_ = std::current_exception();
+            }
+            flow_.stop();
+        }
+    }
+
+    /**
+     * @brief Invokes stage K on the token's current value and stores its output.
+     * @param slot Token slot.
+     */
+    template<size_t K>
+    auto run_stage_at(Slot& slot) -> void
+    {
+        auto& fn = std::get<K>(stages_).fn;
+        if constexpr (K == 0) {
+            slot.value.template emplace<1>(fn(flow_));
+        }
+        else if constexpr (std::is_void_v<Output<K>>) {
+            fn(std::move(std::get<K>(slot.value)));
+            slot.value.template emplace<0>();
+        }
+        else {
+            slot.value.template emplace<K + 1>(fn(std::move(std::get<K>(slot.value))));
+        }
+    }
+
+    /**
+     * @brief Builds the table mapping a stage index to its run_stage_at instantiation.
+     * @return One member function pointer per stage.
+     */
+    template<size_t... Ks>
+    static constexpr auto make_stage_runners(std::index_sequence<Ks...>)
+    {
+        return std::array<void (PipelineRun::*)(Slot&), kStageCount>{&PipelineRun::run_stage_at<Ks>...};
+    }
+
+private:
+    IThreadPool& pool_;                              ///< Pool running the stages
+    const size_t max_tokens_;                        ///< Maximum number of tokens in flight
+    std::tuple<Stages&...> stages_;                  ///< Stages, owned by the caller
+    const std::array<StageMode, kStageCount> modes_; ///< Mode of each stage
+    std::array<SerialState, kStageCount> serial_;    ///< Ordering state, used by serial stages
+    std::vector<Slot> slots_;                        ///< Token slots, indexed by sequence % max_tokens_
+    FlowControl flow_;                               ///< Passed to the source
+
+    std::mutex source_mtx_;           ///< Guards slot_busy_, source_waiting_ and error_
+    std::vector<uint8_t> slot_busy_;  ///< Whether each slot holds a token in flight
+    size_t source_seq_ = 0;           ///< Sequence number of the next token
+    bool source_waiting_ = false;     ///< Source stalled on a busy slot
+    std::atomic<size_t> active_{0};   ///< Tokens in flight, plus one while the source is live
+    std::atomic<bool> failed_{false}; ///< Set by the first stage that throws
+    std::exception_ptr error_;        ///< First exception thrown by a stage
+};
+
+} // namespace detail
+
+/**
+ * @brief Streams items from a source stage through a linear chain of stages on a thread pool.
+ *
+ * Each item (token) flows through the stages in order. Serial stages see tokens
+ * one at a time in source order; parallel stages process several tokens at once.
+ * At most max_tokens tokens are in flight, which bounds memory: the source is
+ * not called again until a slot frees up. The source always runs serially.
+ *
+ * A token stays on one worker across consecutive stages it can enter, so
+ * parse, transform and write steps of different items overlap across workers
+ * without building a graph per item.
+ *
+ * @tparam Stages PipelineStage types, source first.
+ * @param pool Thread pool running the stages.
+ * @param max_tokens Maximum number of items in flight (at least 1).
+ * @param stages Pipeline stages, source first. The source calls FlowControl::stop() to end the stream.
+ *
+ * @note Blocks until the stream has ended and every token has left the last
+ *       stage. The calling thread executes queued pool jobs meanwhile.
+ * @note The first exception thrown by a stage stops the source and is rethrown;
+ *       tokens still in flight skip their remaining stages.
+ *
+ * Usage:
+ * @code
+ * tw::parallel_pipeline(pool, 16,
+ *     tw::PipelineStage{tw::StageMode::SerialInOrder, [&](tw::FlowControl& flow) {
+ *         std::string line;
+ *         if (!std::getline(input, line)) {
+ *             flow.stop();
+ *         }
+ *         return line;
+ *     }},
+ *     tw::PipelineStage{tw::StageMode::Parallel, [](std::string line) { return parse(line); }},
+ *     tw::PipelineStage{tw::StageMode::SerialInOrder, [&](Record record) { output << record; }});
+ * @endcode
+ */
+template<typename... Stages>
+auto parallel_pipeline(IThreadPool& pool, size_t max_tokens, Stages... stages) -> void
+{
+    detail::PipelineRun<Stages...> run(pool, max_tokens, stages...);
+    run.run();
+}
+
+} // namespace tw
@@ -0,0 +1,332 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Snapshot of a log2-bucketed histogram.
+ *
+ * Bucket 0 counts the value 0 and bucket i (i > 0) counts the values in
+ * [2^(i-1), 2^i); the last bucket also takes everything above.
+ */
+struct Histogram {
+    static constexpr size_t kBucketCount = 48; ///< Up to 2^47 (about 39 hours in ns)
+
+    std::array<uint64_t, kBucketCount> buckets{}; ///< Sample count per bucket
+
+    /**
+     * @brief Returns the bucket a value falls in.
+     * @param value Sample value.
+     * @return Index into buckets.
+     */
+    static constexpr auto bucket_of(uint64_t value) noexcept -> size_t
+    {
+        return std::min<size_t>(std::bit_width(value), kBucketCount - 1);
+    }
+
+    /**
+     * @brief Returns the largest value a bucket counts.
+     * @param bucket Index into buckets.
+     * @return Inclusive upper bound of the bucket (UINT64_MAX for the last one).
+     */
+    static constexpr auto upper_bound(size_t bucket) noexcept -> uint64_t
+    {
+        return bucket + 1 >= kBucketCount ? UINT64_MAX : (uint64_t{1} << bucket) - 1;
+    }
+
+    /**
+     * @brief Returns the number of samples.
+     * @return Sum of all buckets.
+     */
+    auto count() const noexcept -> uint64_t
+    {
+        uint64_t total = 0;
+        for (auto bucket : buckets) {
+            total += bucket;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Returns an upper bound of a percentile.
+     * @param fraction Percentile as a fraction in [0, 1] (0.99 for p99).
+     * @return Upper bound of the bucket holding the percentile, or 0 if there are no samples.
+     */
+    auto percentile(double fraction) const noexcept -> uint64_t
+    {
+        const uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::clamp(fraction, 0.0, 1.0) * total));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; bucket++) {
+            seen += buckets[bucket];
+            if (seen >= rank) {
+                return upper_bound(bucket);
+            }
+        }
+        return upper_bound(kBucketCount - 1);
+    }
+
+    /**
+     * @brief Adds the samples of another histogram.
+     * @param other Histogram to merge in.
+     * @return Reference to this histogram.
+     */
+    auto operator+=(const Histogram& other) noexcept -> Histogram&
+    {
+        for (size_t bucket = 0; bucket < kBucketCount; bucket++) {
+            buckets[bucket] += other.buckets[bucket];
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief Counters of one worker (or of the threads helping through try_execute_one()).
+ *
+ * A worker is busy from the pickup of a task until it finds the queue empty,
+ * and idle (polling or parked) until the next pickup. To keep clock reads off
+ * the per-task path, busy time is accounted when the worker turns idle and
+ * every kBusyFlushInterval tasks in between. Helpers are busy only while they
+ * run a task and have no idle time.
+ */
+struct WorkerMetrics {
+    uint64_t tasks_executed = 0;   ///< Tasks run
+    uint64_t busy_ns = 0;          ///< Time spent busy (running and picking up tasks)
+    uint64_t idle_ns = 0;          ///< Time spent polling or parked
+    uint64_t wakeups = 0;          ///< Times the worker was woken from parking for queued work
+    uint64_t spurious_wakeups = 0; ///< Wakeups that found the queue already drained
+    Histogram queue_latency_ns{};  ///< Time from queuing to pickup of the sampled tasks run
+
+    /**
+     * @brief Adds the counters of another worker.
+     * @param other Counters to merge in.
+     * @return Reference to these counters.
+     */
+    auto operator+=(const WorkerMetrics& other) noexcept -> WorkerMetrics&
+    {
+        tasks_executed += other.tasks_executed;
+        busy_ns += other.busy_ns;
+        idle_ns += other.idle_ns;
+        wakeups += other.wakeups;
+        spurious_wakeups += other.spurious_wakeups;
+        queue_latency_ns += other.queue_latency_ns;
+        return *this;
+    }
+};
+
+/**
+ * @brief Point-in-time snapshot of the runtime metrics of a ThreadPool.
+ *
+ * Counters are cumulative since the pool was created; scrape periodically and
+ * subtract two snapshots to get rates.
+ */
+struct ThreadPoolMetrics {
+    static constexpr uint64_t kLatencySampleInterval = 64; ///< One in this many submissions is timed
+    static constexpr uint64_t kBusyFlushInterval = 64;     ///< Busy tasks between two busy time updates
+
+    std::vector<WorkerMetrics> workers; ///< One entry per worker slot (a restarted worker continues its slot)
+    WorkerMetrics helpers{};            ///< Tasks run through try_execute_one() by any thread
+    Histogram queue_depth{};            ///< Queued task count right after each submission
+
+    /**
+     * @brief Returns the counters of all workers and helpers combined.
+     * @return Sum of workers and helpers.
+     */
+    auto total() const noexcept -> WorkerMetrics
+    {
+        WorkerMetrics sum = helpers;
+        for (const auto& worker : workers) {
+            sum += worker;
+        }
+        return sum;
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Live histogram of relaxed atomic buckets; see Histogram.
+ */
+class AtomicHistogram {
+public:
+    /**
+     * @brief Counts one sample; any thread may record.
+     * @param value Sample value.
+     */
+    auto record(uint64_t value) noexcept -> void
+    {
+        buckets_[Histogram::bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts one sample without a read-modify-write.
+     * @param value Sample value.
+     *
+     * @note Only one thread may record into this histogram.
+     */
+    auto record_owned(uint64_t value) noexcept -> void
+    {
+        auto& bucket = buckets_[Histogram::bucket_of(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the buckets.
+     * @return Snapshot (buckets are read one by one, not atomically as a whole).
+     */
+    auto load() const noexcept -> Histogram
+    {
+        Histogram histogram;
+        for (size_t bucket = 0; bucket < Histogram::kBucketCount; bucket++) {
+            histogram.buckets[bucket] = buckets_[bucket].load(std::memory_order_relaxed);
+        }
+        return histogram;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, Histogram::kBucketCount> buckets_{}; ///< Sample count per bucket
+};
+
+/**
+ * @brief Live counters of one worker, on cache lines of their own.
+ *
+ * Written by the owning worker with relaxed loads and stores (add_owned), or
+ * by any thread with relaxed increments (add) when shared; read by snapshots.
+ * Two workers never write to the same cache line.
+ */
+struct alignas(64) WorkerCounters {
+    std::atomic<uint64_t> tasks_executed{0};
+    std::atomic<uint64_t> busy_ns{0};
+    std::atomic<uint64_t> idle_ns{0};
+    std::atomic<uint64_t> wakeups{0};
+    std::atomic<uint64_t> spurious_wakeups{0};
+    AtomicHistogram queue_latency_ns;
+
+    /**
+     * @brief Adds to a counter that several threads write.
+     */
+    static auto add(std::atomic<uint64_t>& counter, uint64_t value) noexcept -> void
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds to a counter that only the calling thread writes.
+     */
+    static auto add_owned(std::atomic<uint64_t>& counter, uint64_t value) noexcept -> void
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the counters.
+     * @return Snapshot of the counters.
+     */
+    auto load() const noexcept -> WorkerMetrics
+    {
+        return WorkerMetrics{.tasks_executed = tasks_executed.load(std::memory_order_relaxed),
+                             .busy_ns = busy_ns.load(std::memory_order_relaxed),
+                             .idle_ns = idle_ns.load(std::memory_order_relaxed),
+                             .wakeups = wakeups.load(std::memory_order_relaxed),
+                             .spurious_wakeups = spurious_wakeups.load(std::memory_order_relaxed),
+                             .queue_latency_ns = queue_latency_ns.load()};
+    }
+};
+
+/**
+ * @brief Converts a duration to nanoseconds, clamping negative ones to 0.
+ */
+inline auto to_ns(std::chrono::steady_clock::duration duration) noexcept -> uint64_t
+{
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+}
+
+/**
+ * @brief Splits the time of one worker into busy and idle, reading the clock only on a switch.
+ *
+ * While the worker stays busy, its busy time is also flushed every
+ * kBusyFlushInterval tasks so that periodic snapshots see it progress.
+ */
+class BusyTimer {
+public:
+    /**
+     * @brief Starts timing an idle worker.
+     * @param counters Counters owned by the worker.
+     */
+    explicit BusyTimer(WorkerCounters& counters) noexcept
+        : counters_(counters)
+        , since_(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * @brief Returns the counters of the worker.
+     */
+    auto get_counters() noexcept -> WorkerCounters&
+    {
+        return counters_;
+    }
+
+    /**
+     * @brief Marks a task pickup: ends the idle stretch, or counts one more busy task.
+     */
+    auto on_task() noexcept -> void
+    {
+        WorkerCounters::add_owned(counters_.tasks_executed, 1);
+        if (!is_busy_) {
+            switch_to(true);
+        }
+        else if (++tasks_since_flush_ >= ThreadPoolMetrics::kBusyFlushInterval) {
+            switch_to(true);
+        }
+    }
+
+    /**
+     * @brief Marks that the worker found no task; ends the busy stretch.
+     */
+    auto on_idle() noexcept -> void
+    {
+        if (is_busy_) {
+            switch_to(false);
+        }
+    }
+
+private:
+    /**
+     * @brief Accounts the time since the last switch to the current state, then enters a state.
+     */
+    auto switch_to(bool busy) noexcept -> void
+    {
+        const auto now = std::chrono::steady_clock::now();
+        WorkerCounters::add_owned(is_busy_ ? counters_.busy_ns : counters_.idle_ns, to_ns(now - since_));
+        since_ = now;
+        is_busy_ = busy;
+        tasks_since_flush_ = 0;
+    }
+
+    WorkerCounters& counters_;                    ///< Counters of the worker
+    std::chrono::steady_clock::time_point since_; ///< Start of the current stretch (or last flush)
+    uint64_t tasks_since_flush_ = 0;              ///< Busy tasks since since_
+    bool is_busy_ = false;                        ///< Current state
+};
+
+} // namespace detail
+
+} // namespace tw
@@ -0,0 +1,359 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "TaskWeave/ITask.h"
+#include "TaskWeave/ThisTask.h"
+#include "CompiledGraph.h"
+#include "IThreadPool.h"
+#include "ThreadPoolExecutor.h"
+
+// STL
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Set of child jobs and tasks spawned at runtime, with a join.
+ *
+ * A TaskGroup lets a running task create work once its fan-out is known
+ * (e.g. one child per partition computed by the parent):
+ * - spawn() submits a callable
+ * - spawn_task() submits an independent task
+ * - spawn_graph() submits child tasks wired with edges among themselves; they
+ *   run dependency-driven, each submitted once its predecessors have completed
+ *
+ * Children run on the executor's thread pool with ThreadPoolExecutor::current()
+ * set, so they can open TaskGroups of their own. join() returns once every child
+ * has finished. While joining, the thread runs the group's own children that no
+ * worker has picked up yet (and, with DependencyDriven dispatch, other queued
+ * pool jobs), so a join completes even when every worker is joining.
+ *
+ * A child dropped by ThreadPoolExecutor::cancel() counts as finished, so a join
+ * never hangs on a cancelled run. The destructor joins.
+ *
+ * @note A TaskGroup is used by the thread that created it; children spawn into their own groups.
+ *
+ * Usage:
+ * @code
+ * Task<int, Partitioning> parent;
+ * parent.set_callable([](Partitioning partitioning) {
+ *     std::vector<int> sums(partitioning.count);
+ *     TaskGroup group;
+ *     for (size_t i = 0; i < partitioning.count; i++) {
+ *         group.spawn([&sums, &partitioning, i]() { sums[i] = partitioning.sum(i); });
+ *     }
+ *     group.join();
+ *     return std::accumulate(sums.begin(), sums.end(), 0);
+ * });
+ * @endcode
+ */
+class TaskGroup {
+public:
+    /**
+     * @brief Creates a group on the executor running the calling task.
+     *
+     * @note Must be called from inside a task or job of a ThreadPoolExecutor.
+     */
+    TaskGroup()
+        : TaskGroup(current_executor())
+    {
+    }
+
+    /**
+     * @brief Creates a group on the given executor.
+     * @param executor Executor whose thread pool runs the children.
+     */
+    explicit TaskGroup(ThreadPoolExecutor& executor)
+        : executor_(&executor)
+    {
+    }
+
+    /**
+     * @brief Joins every child before the group goes away.
+     */
+    ~TaskGroup()
+    {
+        join();
+    }
+
+    // Uncopyable class
+    TaskGroup(const TaskGroup&) = delete;
+    auto operator=(const TaskGroup&) -> TaskGroup& = delete;
+
+    // Unmovable class
+    TaskGroup(TaskGroup&&) = delete;
+    auto operator=(TaskGroup&&) -> TaskGroup& = delete;
+
+    /**
+     * @brief Submits a child callable.
+     * @param fn Callable invocable with no arguments.
+     */
+    template<typename Fn>
+    auto spawn(Fn&& fn) -> void
+    {
+        state_->pending.fetch_add(1, std::memory_order_relaxed);
+        auto child = std::make_shared<Child>(
+            IThreadPool::TaskFunction([token = PendingToken{state_}, job = std::forward<Fn>(fn)]() mutable {
+                job();
+            }));
+        {
+            std::lock_guard lck{state_->mtx};
+            state_->children.push_back(child);
+        }
+        executor_->spawn(ChildJob{std::move(child)});
+        // Wakes a join sleeping while this child was spawned from another thread
+        state_->pending.notify_all();
+    }
+
+    /**
+     * @brief Submits a child task.
+     * @param task Task to run. Must outlive the join.
+     *
+     * @note The task waits for its inward edges inside its worker; use spawn_graph()
+     *       for children that depend on each other.
+     */
+    auto spawn_task(ITask* task) -> void
+    {
+        spawn([task]() {
+            task->run();
+        });
+    }
+
+    /**
+     * @brief Submits child tasks wired with edges, dependency-driven.
+     * @tparam TaskRange Range of ITask pointers.
+     * @param tasks Child tasks. Must outlive the join.
+     *
+     * The tasks are compiled into a CompiledGraph owned by the group; tasks without
+     * in-graph predecessors are submitted immediately, the others once their last
+     * predecessor completes.
+     */
+    template<std::ranges::input_range TaskRange>
+    auto spawn_graph(TaskRange&& tasks) -> void
+    {
+        auto& graph = *graphs_.emplace_back(std::make_unique<CompiledGraph>(std::forward<TaskRange>(tasks)));
+        for (auto root : graph.get_roots()) {
+            spawn_graph_task(graph, root);
+        }
+    }
+
+    /**
+     * @brief Waits until every child has finished.
+     *
+     * Inside a job of the group's executor, the thread first runs the group's
+     * children that are still queued. With DependencyDriven dispatch it then
+     * executes other queued pool jobs (IThreadPool::try_execute_one); with Eager
+     * dispatch it does not, since those may block on inward edges of the joining
+     * task itself. Once there is nothing to run, the thread sleeps inside a
+     * BlockingRegion, so an elastic pool starts a worker for the queued work.
+     */
+    auto join() -> void
+    {
+        IThreadPool* pool = executor_->get_pool();
+        const bool can_run_children = ThreadPoolExecutor::current() == executor_;
+        const bool can_help =
+            pool != nullptr && executor_->get_options().dispatch_mode == DispatchMode::DependencyDriven;
+        while (true) {
+            const size_t pending = state_->pending.load(std::memory_order_acquire);
+            if (pending == 0) {
+                break;
+            }
+            if (can_run_children && run_queued_child()) {
+                continue;
+            }
+            if (can_help && pool->try_execute_one()) {
+                continue;
+            }
+            BlockingRegion blocking;
+            state_->pending.wait(pending, std::memory_order_acquire);
+        }
+        {
+            std::lock_guard lck{state_->mtx};
+            state_->children.clear();
+        }
+        graphs_.clear();
+    }
+
+    /**
+     * @brief Returns the number of children that have not finished.
+     * @return Pending child count (graph children count once submitted).
+     */
+    auto get_pending_count() const noexcept -> size_t
+    {
+        return state_->pending.load(std::memory_order_acquire);
+    }
+
+private:
+    /**
+     * @brief Returns the executor running the calling task.
+     * @return Reference to ThreadPoolExecutor::current().
+     */
+    static auto current_executor() noexcept -> ThreadPoolExecutor&
+    {
+        assert(ThreadPoolExecutor::current() != nullptr && "TaskGroup() must be created inside an executor task");
+        return *ThreadPoolExecutor::current();
+    }
+
+    /**
+     * @brief A spawned child, run once by whichever comes first: a pool worker or the join.
+     */
+    struct Child {
+        explicit Child(IThreadPool::TaskFunction&& child_job) noexcept
+            : job(std::move(child_job))
+        {
+        }
+
+        /**
+         * @brief Claims the child.
+         * @return The job to run, or an empty function if it was already claimed.
+         */
+        auto take() noexcept -> IThreadPool::TaskFunction
+        {
+            if (claimed.exchange(true, std::memory_order_acq_rel)) {
+                return {};
+            }
+            return std::move(job);
+        }
+
+        std::atomic<bool> claimed{false}; ///< Set by the first taker
+        IThreadPool::TaskFunction job;    ///< Child callable with its PendingToken
+    };
+
+    /**
+     * @brief Children state shared with the pool jobs, so it outlives the group while a child finishes.
+     */
+    struct State {
+        std::atomic<size_t> pending{0};             ///< Children submitted and not finished
+        std::mutex mtx;                             ///< Protects children
+        std::deque<std::shared_ptr<Child>> children; ///< Spawned children, claimed or not, until join()
+    };
+
+    /**
+     * @brief Pool job of a child: runs it unless the join took it first.
+     *
+     * A job dropped from the queue (e.g. by ThreadPoolExecutor::cancel()) claims
+     * and destroys the child, so it counts as finished and the join does not run it.
+     */
+    class ChildJob {
+    public:
+        explicit ChildJob(std::shared_ptr<Child> child) noexcept
+            : child_(std::move(child))
+        {
+        }
+
+        ChildJob(ChildJob&&) noexcept = default;
+
+        ~ChildJob()
+        {
+            if (child_ != nullptr) {
+                child_->take();
+            }
+        }
+
+        // Uncopyable class
+        ChildJob(const ChildJob&) = delete;
+        auto operator=(const ChildJob&) -> ChildJob& = delete;
+        auto operator=(ChildJob&&) -> ChildJob& = delete;
+
+        auto operator()() -> void
+        {
+            if (auto job = child_->take()) {
+                job();
+            }
+        }
+
+    private:
+        std::shared_ptr<Child> child_; ///< Child to run, nullptr once moved from
+    };
+
+    /**
+     * @brief Marks a child as finished when destroyed, whether it ran or was dropped.
+     *
+     * Holds the shared state, so waking the join stays valid after the join returned.
+     */
+    class PendingToken {
+    public:
+        explicit PendingToken(std::shared_ptr<State> state) noexcept
+            : state_(std::move(state))
+        {
+        }
+
+        PendingToken(PendingToken&& other) noexcept = default;
+
+        ~PendingToken()
+        {
+            if (state_ != nullptr && state_->pending.fetch_sub(1, std::memory_order_release) == 1) {
+                state_->pending.notify_all();
+            }
+        }
+
+        // Uncopyable class
+        PendingToken(const PendingToken&) = delete;
+        auto operator=(const PendingToken&) -> PendingToken& = delete;
+        auto operator=(PendingToken&&) -> PendingToken& = delete;
+
+    private:
+        std::shared_ptr<State> state_; ///< State to notify, nullptr once moved from
+    };
+
+    /**
+     * @brief Runs the oldest child of the group that no worker has claimed.
+     * @return true if a child was run.
+     */
+    auto run_queued_child() -> bool
+    {
+        while (true) {
+            std::shared_ptr<Child> child;
+            {
+                std::lock_guard lck{state_->mtx};
+                if (state_->children.empty()) {
+                    return false;
+                }
+                child = std::move(state_->children.front());
+                state_->children.pop_front();
+            }
+            if (auto job = child->take()) {
+                job();
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Submits one task of a child graph; when it completes, submits the successors it made ready.
+     * @param graph Child graph.
+     * @param index Position of the task in the graph.
+     *
+     * Successors are submitted before the task's own token is released, so the
+     * pending count cannot reach zero while the graph still has work.
+     */
+    auto spawn_graph_task(CompiledGraph& graph, size_t index) -> void
+    {
+        spawn([this, &graph, index]() {
+            graph.get_task(index)->run();
+            for (auto successor : graph.get_successors(index)) {
+                if (graph.release_predecessor(successor)) {
+                    spawn_graph_task(graph, successor);
+                }
+            }
+        });
+    }
+
+private:
+    ThreadPoolExecutor* executor_;                             ///< Executor running the children
+    std::shared_ptr<State> state_ = std::make_shared<State>(); ///< Pending count and queued children
+    std::vector<std::unique_ptr<CompiledGraph>> graphs_;       ///< Child graphs, alive until join()
+};
+
+} // namespace tw
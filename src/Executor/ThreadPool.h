@@ -4,43 +4,164 @@
 
 #pragma once
 
-#include "../TaskWeave/Metafunctions.h"
+#include "IThreadPool.h"
+#include "PoolMetrics.h"
+#include "Topology.h"
+
+#include "../TaskWeave/ThisTask.h"
 
 // STL
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <shared_mutex>
+#include <span>
+#include <system_error>
 #include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 namespace tw {
 
+namespace detail {
+
+/**
+ * @brief Hints the CPU that the calling thread is busy-waiting.
+ *
+ * Lowers the power and the pipeline pressure of a spin loop, and yields the core
+ * to the sibling hyper-thread. No-op on architectures without such a hint.
+ */
+inline auto cpu_relax() noexcept -> void
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief How long an idle worker polls the queue before it sleeps.
+ *
+ * An idle worker first spins spin_count times with a CPU pause hint, then
+ * yields its time slice yield_count times, and only then parks on the
+ * condition variable. A task queued while a worker spins or yields is picked
+ * up without a futex wakeup, which dominates the latency of bursty
+ * micro-tasks. Spinning is skipped on single-CPU machines, where it only
+ * delays the thread that would queue the work.
+ */
+struct IdlePolicy {
+    uint32_t spin_count = 256; ///< Polls with cpu_relax() before yielding (0 = none)
+    uint32_t yield_count = 16; ///< Polls with std::this_thread::yield() before parking (0 = none)
+};
+
+/**
+ * @brief How the workers of a ThreadPool are placed on the CPUs of its cpuset.
+ */
+enum class WorkerPinning : uint8_t {
+    None,           ///< Workers may run on any CPU of the cpuset (no affinity set if the cpuset is empty)
+    PerCpu,         ///< Worker i is pinned to the i-th CPU of the cpuset, round-robin
+    PerPhysicalCore ///< Worker i is pinned to one CPU of the i-th physical core, skipping SMT siblings
+};
+
+/**
+ * @brief Worker bounds, idle policy and placement of a ThreadPool.
+ */
+struct ThreadPoolOptions {
+    size_t min_threads = 0;                                     ///< Workers kept alive while idle
+    size_t max_threads = std::thread::hardware_concurrency();  ///< Runnable workers at most (at least 1)
+    std::chrono::milliseconds idle_timeout{10'000};             ///< Idle time before a worker retires (0 = never)
+    bool grow_on_blocking = true; ///< Start a worker for queued work while others sit in a BlockingRegion
+    IdlePolicy idle_policy{};     ///< Polling before an idle worker parks (fixed-size pools too)
+    WorkerPinning pinning = WorkerPinning::None; ///< Placement of the workers on the cpuset
+    std::vector<uint32_t> cpuset{};              ///< CPUs the workers may run on (empty = all allowed)
+    bool collect_metrics = false;                ///< Count per-worker runtime metrics (see ThreadPool::get_metrics())
+};
+
 /**
- * @brief A fixed-size thread pool for concurrent task execution.
+ * @brief A thread pool for concurrent task execution, fixed-size or elastic.
  *
  * ThreadPool provides a thread-safe mechanism for submitting and executing
- * callable tasks across a fixed number of worker threads. It supports
- * task queuing, completion notification, and graceful shutdown.
+ * callable tasks across worker threads. It supports task queuing, completion
+ * notification, and graceful shutdown.
+ * All workers share a single queue; see WorkStealingThreadPool for a
+ * per-worker queue alternative.
+ *
+ * Elastic Workers:
+ * Constructed with ThreadPoolOptions, the pool starts min_threads workers and
+ * starts another one whenever a task is queued while no worker is idle, up to
+ * max_threads. A worker idle for idle_timeout retires while more than
+ * min_threads are alive. With grow_on_blocking, workers inside a BlockingRegion
+ * (e.g. a task waiting for its inputs) do not count against max_threads; the
+ * extra workers retire as soon as they are idle once the blocked ones resume.
+ * ThreadPool(thread_count) is the fixed-size special case: min_threads ==
+ * max_threads == thread_count and no retirement.
+ *
+ * Worker Placement:
+ * ThreadPoolOptions::cpuset restricts the workers to a set of CPUs, and
+ * ThreadPoolOptions::pinning pins each worker to one CPU of it (PerCpu) or to
+ * one CPU per physical core (PerPhysicalCore, from CpuTopology::detect()).
+ * A worker takes the placement of its slot when it starts, so a worker
+ * started in place of a retired one lands on the same CPU. Placement is best
+ * effort: CPUs the process may not use are skipped, and platforms without
+ * thread affinity run unpinned.
+ *
+ * Idle Workers:
+ * An idle worker polls a lock-free queued-task counter according to
+ * IdlePolicy (spin, then yield) before it parks. Submitting a task that a
+ * polling worker will take skips the worker lock and the notify entirely.
+ *
+ * Priority Lanes:
+ * The queue has one FIFO lane per TaskPriority. Workers take the front task of
+ * the highest non-empty lane, so High tasks jump ahead of Normal and Background
+ * work submitted earlier. To keep bulk work from starving, a non-empty lane that
+ * has been passed over starvation_limit times in a row gets the next turn.
+ *
+ * Metrics:
+ * With ThreadPoolOptions::collect_metrics, every worker counts its tasks,
+ * busy and idle time, wakeups and queue latencies into relaxed atomics on
+ * cache lines of its own, and submissions record the queue depth.
+ * get_metrics() returns a snapshot that can be scraped while the pool runs.
+ * Clocks are read on busy/idle switches and for one in
+ * kLatencySampleInterval submissions, not per task. Without collect_metrics,
+ * no clock is read at all.
  *
  * Thread Safety:
  * - Task queue is protected by a shared_mutex for concurrent reads
  * - Worker coordination uses mutex and condition variable
- * - Active task count is atomic for lock-free queries
+ * - Active and queued task counts are atomic for lock-free queries
  *
  * Usage:
  * @code
  * ThreadPool pool{4};  // 4 worker threads
  * pool.run();          // Start workers
  * pool.add_task([]{ <task logic> });
+ * pool.add_task(TaskPriority::High, []{ <latency-critical logic> });
  * pool.wait();         // Wait for completion
  * @endcode
  */
-class ThreadPool {
+class ThreadPool : public IThreadPool, private detail::BlockingObserver {
+public:
+    /// Default number of times a non-empty lane may be passed over before it gets a turn
+    static constexpr size_t kDefaultStarvationLimit = 16;
+
 public:
     /**
      * @brief Constructs a ThreadPool with specified worker count.
@@ -48,9 +169,35 @@ public:
      * @param on_complete_callback Optional callback invoked when all tasks complete.
      */
     explicit ThreadPool(size_t thread_count, const std::function<void()>& on_complete_callback = nullptr)
+        : ThreadPool(ThreadPoolOptions{.min_threads = thread_count,
+                                       .max_threads = thread_count,
+                                       .idle_timeout = std::chrono::milliseconds::zero(),
+                                       .grow_on_blocking = false},
+                     on_complete_callback)
+    {
+    }
+
+    /**
+     * @brief Constructs an elastic ThreadPool.
+     * @param options Worker bounds and idle policy (max_threads is raised to at least min_threads and 1).
+     * @param on_complete_callback Optional callback invoked when all tasks complete.
+     */
+    explicit ThreadPool(const ThreadPoolOptions& options, const std::function<void()>& on_complete_callback = nullptr)
         : on_complete_(on_complete_callback)
-        , thread_count_(thread_count)
+        , options_(options)
     {
+        options_.max_threads = std::max({options_.max_threads, options_.min_threads, size_t{1}});
+        if (std::thread::hardware_concurrency() <= 1) {
+            options_.idle_policy.spin_count = 0;
+        }
+        if (options_.pinning != WorkerPinning::None || !options_.cpuset.empty()) {
+            CpuTopology topology = CpuTopology::detect();
+            if (!options_.cpuset.empty()) {
+                topology = topology.restricted_to(options_.cpuset);
+            }
+            placement_cpus_ = options_.pinning == WorkerPinning::PerPhysicalCore ? topology.get_physical_cores()
+                                                                                 : topology.get_cpu_ids();
+        }
     }
 
     /**
@@ -59,14 +206,16 @@ public:
      * Sets shutdown flag, notifies all workers to exit, and blocks until
      * all threads have been joined.
      */
-    ~ThreadPool()
+    ~ThreadPool() override
     {
+        std::vector<std::thread> workers;
         {
             std::lock_guard lck{worker_mtx_};
             is_shutting_down_ = true;
+            workers = std::move(workers_);
         }
         worker_cv_.notify_all();
-        for (auto& worker : workers_) {
+        for (auto& worker : workers) {
             if (worker.joinable()) {
                 worker.join();
             }
@@ -82,55 +231,29 @@ public:
     auto operator=(ThreadPool&& other) noexcept -> ThreadPool& = delete;
 
     /**
-     * @brief Submits a callable task to the execution queue.
+     * @brief Clears all pending tasks from the queue without executing them.
      *
-     * @tparam Fn Callable type (function pointer, lambda, std::function, etc.).
-     * @tparam Args Argument types to forward to the callable.
-     * @param fn Callable to execute.
-     * @param args Arguments to forward to the callable.
-     * @return true if task was successfully queued, false if fn is nullptr.
+     * Reduces active task count by the number of cleared tasks and wakes
+     * waiters if the pool became idle. Does not affect tasks currently in execution.
      *
-     * @note Performs compile-time check to reject nullptr function pointers
-     *       and std::function objects. Other callable types bypass this check.
-     * @note Thread-safe: acquires worker and task locks.
+     * @note Thread-safe: acquires task lock. The cleared tasks are destroyed after
+     *       the lock is released, so their destructors may submit new tasks.
      */
-    template<typename Fn, typename... Args>
-    auto add_task(Fn&& fn, Args&&... args) -> bool
+    auto clear_queued_tasks() -> void override
     {
-        // Only check for nullptr if it's a function pointer or an std::function types
-        if constexpr (std::is_pointer_v<std::remove_cvref_t<Fn>> || is_std_function_v<std::remove_cvref_t<Fn>>) {
-            if (fn == nullptr) {
-                return false;
-            }
-        }
+        size_t cleared = 0;
+        std::array<std::queue<QueuedTask>, kTaskPriorityCount> dropped;
         {
-            {
-                std::unique_lock worker_lck{worker_mtx_};
-                std::unique_lock lck(tasks_mtx_);
-                tasks_.emplace([f = std::forward<Fn>(fn), ... captured_args = std::forward<Args>(args)]() {
-                    std::invoke(f, std::move(captured_args)...);
-                });
-                active_task_count_.fetch_add(1, std::memory_order_acq_rel);
+            std::unique_lock lck{tasks_mtx_};
+            for (size_t lane = 0; lane < kTaskPriorityCount; lane++) {
+                cleared += lanes_[lane].size();
+                dropped[lane].swap(lanes_[lane]);
             }
-            worker_cv_.notify_one();
+            queued_count_.fetch_sub(cleared, std::memory_order_relaxed);
         }
-        return true;
-    }
-
-    /**
-     * @brief Clears all pending tasks from the queue without executing them.
-     *
-     * Reduces active task count by the number of cleared tasks.
-     * Does not affect tasks currently in execution.
-     *
-     * @note Thread-safe: acquires task lock.
-     */
-    auto clear_queued_tasks() -> void
-    {
-        std::unique_lock lck{tasks_mtx_};
-        active_task_count_.fetch_sub(tasks_.size(), std::memory_order_release);
-        if (!tasks_.empty()) {
-            tasks_ = {};
+        dropped = {};
+        if (cleared > 0) {
+            complete_tasks(static_cast<int>(cleared));
         }
     }
 
@@ -138,13 +261,23 @@ public:
      * @brief Spawns worker threads and begins task processing.
      *
      * Must be called after construction to activate the thread pool.
+     * Starts min_threads workers, or one per queued task up to max_threads.
      * Workers will block on condition variable until tasks are available.
+     * Subsequent calls are no-ops, so a pool can be shared by several runs.
      *
-     * @note Not thread-safe: should be called once before / after submitting tasks.
+     * @note Thread-safe: acquires worker lock.
      */
-    auto run() noexcept -> void
+    auto run() noexcept -> void override
     {
-        spawn_thread(thread_count_);
+        std::unique_lock lck{worker_mtx_};
+        if (is_running_) {
+            return;
+        }
+        is_running_ = true;
+        const size_t count = std::max(options_.min_threads, std::min(size(), options_.max_threads));
+        for (size_t i = 0; i < count; i++) {
+            spawn_worker();
+        }
     }
 
     /**
@@ -155,7 +288,7 @@ public:
      *
      * @note Thread-safe: uses dedicated wait mutex.
      */
-    auto wait() const noexcept -> void
+    auto wait() const noexcept -> void override
     {
         std::unique_lock lck(wait_mtx_);
         wait_cv_.wait(lck, [this]() {
@@ -164,16 +297,37 @@ public:
     }
 
     /**
-     * @brief Returns a copy of the current task queue.
-     * @return Copy of pending tasks queue (does not include executing tasks).
+     * @brief Sets how often a non-empty lane may be passed over before it gets a turn.
+     * @param limit Number of consecutive pops that may skip a non-empty lane (at least 1;
+     *        1 alternates between the highest lane and a waiting lower one).
      *
-     * @note Thread-safe: uses shared lock allowing concurrent reads.
-     * @warning Creates a full copy of the queue - may be expensive.
+     * @note Thread-safe: acquires task lock.
      */
-    auto get_queued_tasks() const noexcept -> std::queue<std::function<void()>>
+    auto set_starvation_limit(size_t limit) -> void
     {
-        std::shared_lock lck(tasks_mtx_);
-        return tasks_;
+        std::unique_lock lck{tasks_mtx_};
+        starvation_limit_ = std::max<size_t>(limit, 1);
+    }
+
+    /**
+     * @brief Returns the starvation limit of the priority lanes.
+     * @return Number of consecutive pops that may skip a non-empty lane.
+     */
+    auto get_starvation_limit() const -> size_t
+    {
+        std::shared_lock lck{tasks_mtx_};
+        return starvation_limit_;
+    }
+
+    /**
+     * @brief Runs the next task of the queue on the calling thread, if any.
+     * @return true if a task was executed.
+     *
+     * @note Thread-safe: acquires task lock to pop.
+     */
+    auto try_execute_one() -> bool override
+    {
+        return execute_task(nullptr);
     }
 
     /**
@@ -183,7 +337,7 @@ public:
      * @note Lock-free: uses atomic load with acquire semantics.
      * @warning Race condition possible: result may be stale immediately.
      */
-    auto is_idle() const noexcept -> bool
+    auto is_idle() const noexcept -> bool override
     {
         auto count = active_task_count_.load(std::memory_order_acquire);
         return count == 0;
@@ -195,120 +349,574 @@ public:
      *
      * @note Lock-free: uses atomic load with acquire semantics.
      */
-    auto active_task_count() const noexcept -> int
+    auto active_task_count() const noexcept -> int override
     {
         return active_task_count_.load(std::memory_order_acquire);
     }
 
     /**
      * @brief Checks if the task queue is empty.
-     * @return true if no tasks are waiting in the queue.
+     * @return true if no tasks are waiting in any lane.
      *
-     * @note Thread-safe: uses shared lock.
+     * @note Lock-free: uses atomic load.
      * @warning Does not indicate if tasks are currently executing.
      */
-    auto empty() const noexcept -> bool
+    auto empty() const noexcept -> bool override
     {
-        std::shared_lock lck{tasks_mtx_};
-        return tasks_.empty();
+        return queued_count_.load(std::memory_order_seq_cst) == 0;
     }
 
     /**
      * @brief Returns the number of tasks in the queue.
-     * @return Count of pending tasks (not including executing tasks).
+     * @return Count of pending tasks in all lanes (not including executing tasks).
      *
-     * @note Thread-safe: uses shared lock.
+     * @note Lock-free: uses atomic load.
      */
-    auto size() const noexcept -> size_t
+    auto size() const noexcept -> size_t override
     {
-        std::shared_lock lck{tasks_mtx_};
-        return tasks_.size();
+        return queued_count_.load(std::memory_order_seq_cst);
     }
 
     /**
      * @brief Returns the configured number of worker threads.
-     * @return Thread count specified at construction.
+     * @return Thread count specified at construction (max_threads of an elastic pool).
+     */
+    auto worker_count() const noexcept -> size_t override
+    {
+        return options_.max_threads;
+    }
+
+    /**
+     * @brief Returns the number of worker threads currently alive.
+     * @return Live workers, including idle and blocked ones.
+     *
+     * @note Thread-safe: acquires worker lock.
+     */
+    auto live_worker_count() const -> size_t
+    {
+        std::lock_guard lck{worker_mtx_};
+        return live_worker_count_;
+    }
+
+    /**
+     * @brief Returns the worker bounds, idle policy and placement.
+     * @return Options given at construction (fixed-size pools report min == max).
+     */
+    auto get_options() const noexcept -> const ThreadPoolOptions&
+    {
+        return options_;
+    }
+
+    /**
+     * @brief Returns a snapshot of the runtime metrics.
+     * @return Cumulative counters per worker slot, of the helping threads, and the
+     *         queue depth histogram; all empty unless collect_metrics is set.
+     *
+     * @note Thread-safe: acquires worker lock. Counters are read one by one, so a
+     *       snapshot taken while tasks run is only approximately consistent.
      */
-    auto worker_count() const noexcept -> size_t
+    auto get_metrics() const -> ThreadPoolMetrics
     {
-        return thread_count_;
+        ThreadPoolMetrics metrics;
+        if (!options_.collect_metrics) {
+            return metrics;
+        }
+        {
+            std::lock_guard lck{worker_mtx_};
+            metrics.workers.reserve(worker_counters_.size());
+            for (const auto& counters : worker_counters_) {
+                metrics.workers.push_back(counters->load());
+            }
+        }
+        metrics.helpers = helper_counters_.load();
+        metrics.queue_depth = queue_depth_.load();
+        return metrics;
+    }
+
+protected:
+    /**
+     * @brief Pushes a wrapped task to the back of the Normal lane.
+     * @param task Task to execute on a worker thread.
+     */
+    auto enqueue(TaskFunction task) -> void override
+    {
+        enqueue_with_priority(std::move(task), TaskPriority::Normal);
+    }
+
+    /**
+     * @brief Pushes a wrapped task to the back of a priority lane.
+     * @param task Task to execute on a worker thread.
+     * @param priority Lane to queue the task in.
+     *
+     * @note Thread-safe: acquires task lock, then wakes one worker (see wake_workers).
+     */
+    auto enqueue_with_priority(TaskFunction task, TaskPriority priority) -> void override
+    {
+        size_t queued = 0;
+        {
+            std::unique_lock lck(tasks_mtx_);
+            Clock::time_point now{};
+            lanes_[static_cast<size_t>(priority)].push(QueuedTask{std::move(task), sample_queue_time(now)});
+            active_task_count_.fetch_add(1, std::memory_order_acq_rel);
+            queued = queued_count_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        }
+        if (options_.collect_metrics) {
+            queue_depth_.record(queued);
+        }
+        wake_workers(1, queued);
+    }
+
+    /**
+     * @brief Pushes a batch of tasks to the Normal lane under a single lock acquisition.
+     * @param tasks Non-empty span of tasks; elements are moved from.
+     *
+     * Wakes exactly min(N, idle workers) threads and starts workers for the rest, up to max_threads.
+     *
+     * @note Thread-safe: acquires task lock once for the whole batch, then wakes workers (see wake_workers).
+     */
+    auto enqueue_batch(std::span<TaskFunction> tasks) -> void override
+    {
+        size_t queued = 0;
+        {
+            std::unique_lock lck(tasks_mtx_);
+            auto& lane = lanes_[static_cast<size_t>(TaskPriority::Normal)];
+            Clock::time_point now{};
+            for (auto& task : tasks) {
+                lane.push(QueuedTask{std::move(task), sample_queue_time(now)});
+            }
+            active_task_count_.fetch_add(static_cast<int>(tasks.size()), std::memory_order_acq_rel);
+            queued = queued_count_.fetch_add(tasks.size(), std::memory_order_seq_cst) + tasks.size();
+        }
+        if (options_.collect_metrics) {
+            queue_depth_.record(queued);
+        }
+        wake_workers(tasks.size(), queued);
     }
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A task in a lane, with the time it was queued if its latency is sampled.
+     */
+    struct QueuedTask {
+        TaskFunction task;        ///< Task to execute
+        Clock::time_point queued; ///< Submission time, or default if not sampled
+    };
+
+    /**
+     * @brief Wakes parked workers for newly queued tasks, starting workers if none are idle.
+     * @param count Number of tasks just queued.
+     * @param queued Queued task count right after they were queued.
+     *
+     * Returns without locking when the polling workers outnumber the queued
+     * tasks. Otherwise wakes exactly min(count, parked workers) threads and
+     * starts workers for the rest, up to max_threads.
+     *
+     * The queued count is published before the polling count is read, and a
+     * polling worker leaves the count before it re-checks the queue under
+     * worker_mtx_ (both sequentially consistent), so a task cannot be left
+     * without a worker.
+     */
+    auto wake_workers(size_t count, size_t queued) -> void
+    {
+        const size_t polling = polling_worker_count_.load(std::memory_order_seq_cst);
+        if (queued <= polling) {
+            return;
+        }
+        size_t idle_workers = 0;
+        {
+            std::unique_lock worker_lck{worker_mtx_};
+            idle_workers = idle_worker_count_;
+            if (count > idle_workers + polling) {
+                grow(count - idle_workers - polling);
+            }
+        }
+        const size_t to_wake = std::min(count, idle_workers);
+        if (to_wake == idle_workers) {
+            worker_cv_.notify_all();
+        }
+        else {
+            for (size_t i = 0; i < to_wake; i++) {
+                worker_cv_.notify_one();
+            }
+        }
+    }
+
     /**
      * @brief Executes a single task from the queue.
+     * @param timer Busy timer of the calling worker, or nullptr for helpers and when metrics are off.
+     * @return true if a task was popped and executed.
      *
-     * Pops the front task from the queue and invokes it.
-     * Decrements active task count and notifies waiters if count reaches zero.
-     * Invokes on_complete_ callback when all tasks finish.
+     * Pops the next task (see pop_next_task) and invokes it, then updates
+     * completion accounting.
      *
-     * @note Called by worker threads only.
+     * @note Called by worker threads and by try_execute_one().
      */
-    auto execute_task() -> void
+    auto execute_task(detail::BusyTimer* timer) -> bool
     {
-        std::function<void()> task_to_do;
+        QueuedTask next;
         {
             std::unique_lock lck{tasks_mtx_};
-            if (!tasks_.empty()) {
-                task_to_do = std::move(tasks_.front());
-                tasks_.pop();
+            next = pop_next_task();
+        }
+
+        if (!next.task) {
+            return false;
+        }
+        if (!options_.collect_metrics) {
+            next.task();
+        }
+        else if (timer != nullptr) {
+            timer->on_task();
+            if (next.queued != Clock::time_point{}) {
+                timer->get_counters().queue_latency_ns.record_owned(detail::to_ns(Clock::now() - next.queued));
             }
+            next.task();
+        }
+        else {
+            run_as_helper(next);
+        }
+        complete_tasks(1);
+        return true;
+    }
+
+    /**
+     * @brief Runs a task taken by try_execute_one() and records it in the helper counters.
+     * @param next Popped task.
+     */
+    auto run_as_helper(QueuedTask& next) -> void
+    {
+        const auto begin = Clock::now();
+        if (next.queued != Clock::time_point{}) {
+            helper_counters_.queue_latency_ns.record(detail::to_ns(begin - next.queued));
         }
+        next.task();
+        detail::WorkerCounters::add(helper_counters_.tasks_executed, 1);
+        detail::WorkerCounters::add(helper_counters_.busy_ns, detail::to_ns(Clock::now() - begin));
+    }
 
-        if (task_to_do) {
-            task_to_do();
-            std::unique_lock lck{wait_mtx_};
-            active_task_count_.fetch_sub(1, std::memory_order_acq_rel);
-            auto count = active_task_count_.load(std::memory_order_acquire);
-            if (count == 0) {
-                if (on_complete_) {
-                    on_complete_();
-                }
-                wait_cv_.notify_all();
+    /**
+     * @brief Returns the submission time to store with a task, if its latency is sampled.
+     * @param now Clock value shared by one submission call; read on first use.
+     * @return now for one in kLatencySampleInterval submissions, a default time point otherwise.
+     *
+     * @note Caller must hold tasks_mtx_ exclusively.
+     */
+    auto sample_queue_time(Clock::time_point& now) noexcept -> Clock::time_point
+    {
+        if (!options_.collect_metrics || submission_count_++ % ThreadPoolMetrics::kLatencySampleInterval != 0) {
+            return {};
+        }
+        if (now == Clock::time_point{}) {
+            now = Clock::now();
+        }
+        return now;
+    }
+
+    /**
+     * @brief Pops the front task of the lane whose turn it is.
+     * @return The task, or one with an empty TaskFunction if every lane is empty.
+     *
+     * The highest non-empty lane is chosen, unless a lower non-empty lane has
+     * been passed over starvation_limit_ times; then the highest such lane is
+     * chosen instead. Every other non-empty lane counts one more pass; empty
+     * lanes start over.
+     *
+     * @note Caller must hold tasks_mtx_ exclusively.
+     */
+    auto pop_next_task() -> QueuedTask
+    {
+        size_t chosen = kTaskPriorityCount;
+        for (size_t lane = 0; lane < kTaskPriorityCount; lane++) {
+            if (lanes_[lane].empty()) {
+                continue;
             }
+            if (chosen == kTaskPriorityCount) {
+                chosen = lane;
+            }
+            else if (passed_over_[lane] >= starvation_limit_) {
+                chosen = lane;
+                break;
+            }
+        }
+        if (chosen == kTaskPriorityCount) {
+            return {};
+        }
+        for (size_t lane = 0; lane < kTaskPriorityCount; lane++) {
+            passed_over_[lane] = lane == chosen || lanes_[lane].empty() ? 0 : passed_over_[lane] + 1;
+        }
+
+        QueuedTask task = std::move(lanes_[chosen].front());
+        lanes_[chosen].pop();
+        queued_count_.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    /**
+     * @brief Decrements the active count and notifies waiters on reaching zero.
+     * @param count Number of tasks that finished or were discarded.
+     *
+     * The decrement is a single atomic operation. Only the thread observing the
+     * transition to zero takes wait_mtx_, invokes on_complete_ and notifies
+     * waiters. Taking the mutex before notifying closes the window between a
+     * waiter's idle check and its sleep, so the wakeup cannot be lost.
+     */
+    auto complete_tasks(int count) -> void
+    {
+        if (active_task_count_.fetch_sub(count, std::memory_order_acq_rel) != count) {
+            return;
         }
+        std::lock_guard lck{wait_mtx_};
+        if (on_complete_) {
+            on_complete_();
+        }
+        wait_cv_.notify_all();
     }
 
     /**
-     * @brief Spawns worker threads that continuously process tasks.
+     * @brief Starts workers for queued work while the pool is below its runnable bound.
+     * @param count Number of workers wanted.
      *
-     * Each worker loops until shutdown, waiting on condition variable
-     * for tasks to become available or shutdown signal.
+     * Blocked workers (inside a BlockingRegion) only count against max_threads
+     * when grow_on_blocking is off. If a thread cannot be created, the work is
+     * left to the workers already running.
      *
-     * @param count Number of threads to spawn.
-     * @note Called once during run().
+     * @note Caller must hold worker_mtx_.
      */
-    auto spawn_thread(size_t count) -> void
+    auto grow(size_t count) noexcept -> void
     {
-        for (size_t i = 0; i < count; i++) {
-            workers_.emplace_back([this]() {
-                while (!is_shutting_down_) {
-                    {
-                        std::unique_lock lock{worker_mtx_};
-                        worker_cv_.wait(lock, [this]() {
-                            return !empty() || is_shutting_down_;
-                        });
-                    }
-                    if (is_shutting_down_) {
+        if (!is_running_ || is_shutting_down_) {
+            return;
+        }
+        try {
+            for (size_t i = 0; i < count && runnable_worker_count() < options_.max_threads; i++) {
+                spawn_worker();
+            }
+        }
+        catch (const std::system_error&) {
+            // Out of threads: keep the current workers
+        }
+    }
+
+    /**
+     * @brief Returns the number of live workers that count against max_threads.
+     * @return Live workers minus the blocked ones (with grow_on_blocking).
+     *
+     * @note Caller must hold worker_mtx_.
+     */
+    auto runnable_worker_count() const noexcept -> size_t
+    {
+        return options_.grow_on_blocking ? live_worker_count_ - blocked_worker_count_ : live_worker_count_;
+    }
+
+    /**
+     * @brief Starts one worker thread, reusing the slot of a retired one.
+     *
+     * @note Caller must hold worker_mtx_.
+     */
+    auto spawn_worker() -> void
+    {
+        if (free_slots_.empty()) {
+            free_slots_.push_back(workers_.size());
+            workers_.emplace_back();
+            if (options_.collect_metrics) {
+                worker_counters_.push_back(std::make_unique<detail::WorkerCounters>());
+            }
+        }
+        const size_t slot = free_slots_.back();
+        if (workers_[slot].joinable()) {
+            // The retired thread released the lock for good; joining only waits for its exit
+            workers_[slot].join();
+        }
+        detail::WorkerCounters* counters = options_.collect_metrics ? worker_counters_[slot].get() : nullptr;
+        workers_[slot] = std::thread([this, slot, counters]() {
+            worker_loop(slot, counters);
+        });
+        free_slots_.pop_back();
+        live_worker_count_++;
+    }
+
+    /**
+     * @brief Worker thread: processes tasks until shutdown or retirement.
+     * @param slot Index of the thread handle in workers_.
+     * @param counters Metrics of the slot, or nullptr if metrics are off.
+     *
+     * An idle worker polls the queue (poll_for_work) before it parks. A worker
+     * retires when it has been parked for idle_timeout while more than
+     * min_threads are alive, or at once when it is idle and the pool has more
+     * runnable workers than max_threads (after blocked workers resumed).
+     */
+    auto worker_loop(size_t slot, detail::WorkerCounters* counters) -> void
+    {
+        detail::current_blocking_observer = this;
+        place_worker(slot);
+        std::optional<detail::BusyTimer> timer;
+        if (counters != nullptr) {
+            timer.emplace(*counters);
+        }
+        while (true) {
+            if (timer && empty()) {
+                timer->on_idle();
+            }
+            bool woken = false;
+            if (!poll_for_work()) {
+                std::unique_lock lock{worker_mtx_};
+                if (runnable_worker_count() > options_.max_threads && empty()) {
+                    retire(slot);
+                    return;
+                }
+                woken = empty();
+                idle_worker_count_++;
+                const bool has_work = wait_for_work(lock);
+                idle_worker_count_--;
+                if (is_shutting_down_) {
+                    return;
+                }
+                if (!has_work) {
+                    if (live_worker_count_ > options_.min_threads) {
+                        retire(slot);
                         return;
                     }
-                    execute_task();
+                    continue;
+                }
+                // Tasks queued while the idle workers were being woken: bring in a peer
+                if (idle_worker_count_ == 0 && size() > 1) {
+                    grow(1);
+                }
+            }
+            const bool executed = execute_task(timer ? &*timer : nullptr);
+            if (counters != nullptr && woken) {
+                detail::WorkerCounters::add_owned(counters->wakeups, 1);
+                if (!executed) {
+                    detail::WorkerCounters::add_owned(counters->spurious_wakeups, 1);
                 }
-            });
+            }
+        }
+    }
+
+    /**
+     * @brief Applies the configured placement to the calling worker.
+     * @param slot Index of the worker; selects its CPU when pinning.
+     */
+    auto place_worker(size_t slot) const noexcept -> void
+    {
+        if (placement_cpus_.empty()) {
+            return;
+        }
+        if (options_.pinning == WorkerPinning::None) {
+            set_thread_affinity(placement_cpus_);
         }
+        else {
+            set_thread_affinity(std::span(&placement_cpus_[slot % placement_cpus_.size()], 1));
+        }
+    }
+
+    /**
+     * @brief Polls the queued-task count according to the idle policy.
+     * @return true if a task was queued before the policy ran out.
+     *
+     * @note Lock-free: the worker counts itself as polling, so submitters skip the notify.
+     */
+    auto poll_for_work() noexcept -> bool
+    {
+        const IdlePolicy& policy = options_.idle_policy;
+        if (policy.spin_count == 0 && policy.yield_count == 0) {
+            return false;
+        }
+        polling_worker_count_.fetch_add(1, std::memory_order_seq_cst);
+        bool has_work = false;
+        for (uint32_t i = 0; i < policy.spin_count + policy.yield_count; i++) {
+            if (queued_count_.load(std::memory_order_acquire) > 0) {
+                has_work = true;
+                break;
+            }
+            if (i < policy.spin_count) {
+                detail::cpu_relax();
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        polling_worker_count_.fetch_sub(1, std::memory_order_seq_cst);
+        return has_work;
+    }
+
+    /**
+     * @brief Sleeps until a task is queued, the pool shuts down, or the idle timeout passes.
+     * @param lock Held lock on worker_mtx_.
+     * @return false if the idle timeout passed without work, true otherwise.
+     */
+    auto wait_for_work(std::unique_lock<std::mutex>& lock) -> bool
+    {
+        auto has_work = [this]() {
+            return !empty() || is_shutting_down_;
+        };
+        if (options_.idle_timeout == std::chrono::milliseconds::zero()) {
+            worker_cv_.wait(lock, has_work);
+            return true;
+        }
+        return worker_cv_.wait_for(lock, options_.idle_timeout, has_work);
+    }
+
+    /**
+     * @brief Removes the calling worker from the live count; its handle is joined on reuse or shutdown.
+     * @param slot Index of the thread handle in workers_.
+     *
+     * @note Caller must hold worker_mtx_ and return from the thread right after.
+     */
+    auto retire(size_t slot) -> void
+    {
+        live_worker_count_--;
+        free_slots_.push_back(slot);
+    }
+
+    /**
+     * @brief Counts the calling worker as blocked and starts a replacement if work is queued.
+     */
+    auto on_blocking_begin() noexcept -> void override
+    {
+        std::lock_guard lck{worker_mtx_};
+        blocked_worker_count_++;
+        if (options_.grow_on_blocking && idle_worker_count_ == 0 && !empty()) {
+            grow(1);
+        }
+    }
+
+    /**
+     * @brief Counts the calling worker as runnable again.
+     */
+    auto on_blocking_end() noexcept -> void override
+    {
+        std::lock_guard lck{worker_mtx_};
+        blocked_worker_count_--;
     }
 
 private:
-    std::queue<std::function<void()>> tasks_;       ///< Queue of pending tasks
-    std::vector<std::thread> workers_;              ///< Worker thread handles
+    std::array<std::queue<QueuedTask>, kTaskPriorityCount> lanes_;   ///< Pending tasks, one FIFO per priority
+    std::array<size_t, kTaskPriorityCount> passed_over_{};           ///< Consecutive pops that skipped each lane
+    size_t starvation_limit_ = kDefaultStarvationLimit;              ///< Passes before a lane gets a turn
+    std::vector<std::thread> workers_;              ///< Worker thread handles, live and retired
+    std::vector<size_t> free_slots_;                ///< Slots of retired workers, joined on reuse
     mutable std::shared_mutex tasks_mtx_;           ///< Protects task queue (shared for reads)
-    std::mutex worker_mtx_;                         ///< Protects shutdown flag
+    mutable std::mutex worker_mtx_;                 ///< Protects worker handles, counts and flags
     std::condition_variable worker_cv_;             ///< Notifies workers of new tasks
     mutable std::mutex wait_mtx_;                   ///< Protects wait condition
     mutable std::condition_variable wait_cv_;       ///< Notifies waiters when idle
     std::function<void()> on_complete_;             ///< Callback when all tasks complete
     std::atomic<int> active_task_count_{0};         ///< Count of active/pending tasks
-    size_t thread_count_{};                         ///< Configured worker count
+    std::atomic<size_t> queued_count_{0};           ///< Tasks in the lanes (written under tasks_mtx_)
+    std::atomic<size_t> polling_worker_count_{0};   ///< Idle workers polling instead of parked
+    ThreadPoolOptions options_;                     ///< Worker bounds, idle policy and placement
+    std::vector<uint32_t> placement_cpus_;          ///< Usable CPUs of the cpuset (one per core for PerPhysicalCore)
+    size_t live_worker_count_{};                    ///< Workers started and not retired
+    size_t idle_worker_count_{};                    ///< Workers waiting on worker_cv_
+    size_t blocked_worker_count_{};                 ///< Workers inside a BlockingRegion
+    std::vector<std::unique_ptr<detail::WorkerCounters>> worker_counters_; ///< Metrics per worker slot (if collected)
+    detail::WorkerCounters helper_counters_;        ///< Metrics of try_execute_one() (if collected)
+    detail::AtomicHistogram queue_depth_;           ///< Queued count after each submission (if collected)
+    uint64_t submission_count_{};                   ///< Submissions so far, picks the latency samples (under tasks_mtx_)
+    bool is_running_ = false;                       ///< Set by run(); workers only start afterwards
     bool is_shutting_down_ = false;                 ///< Shutdown flag
 };
 } // namespace tw
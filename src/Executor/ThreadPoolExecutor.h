@@ -6,15 +6,59 @@
 
 #include "TaskWeave/Helper.h"
 #include "TaskWeave/ITask.h"
+#include "TaskWeave/ThisTask.h"
+#include "TaskWeave/Watchdog.h"
+#include "CompiledGraph.h"
+#include "IThreadPool.h"
 #include "ThreadPool.h"
+#include "Tracer.h"
 
 // STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stop_token>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace tw {
 
+/**
+ * @brief Strategy used by ThreadPoolExecutor to hand tasks to the thread pool.
+ */
+enum class DispatchMode : uint32_t {
+    Eager,            ///< Submit every task up front; workers block on inward edges until inputs land
+    DependencyDriven, ///< Submit a task only once all of its scheduled predecessors have completed
+};
+
+/**
+ * @brief Order in which ready tasks are started by dependency-driven dispatch.
+ */
+enum class SchedulingPolicy : uint32_t {
+    Fifo,                 ///< Ready tasks are handed to the thread pool in the order they become ready
+    CriticalPath,         ///< Ready task with the longest remaining chain (in task count) starts first
+    WeightedCriticalPath, ///< Like CriticalPath, with each task weighted by its last measured duration
+};
+
+/**
+ * @brief Configuration for ThreadPoolExecutor.
+ */
+struct ExecutorOptions {
+    DispatchMode dispatch_mode = DispatchMode::Eager;            ///< How tasks are handed to the thread pool
+    SchedulingPolicy scheduling_policy = SchedulingPolicy::Fifo; ///< Ready-task ordering (dependency-driven only)
+    uint32_t max_continuation_depth = 32;                        ///< Max successors run inline per pool job (0 = off)
+    bool cancel_on_failure = false;                              ///< Cancel tasks not started yet once a task fails
+    std::chrono::nanoseconds run_timeout{0};                     ///< Deadline of each run, from run() (0 = none)
+    std::optional<uint32_t> numa_node{};                         ///< NUMA node of tasks without their own hint
+};
+
 /**
  * @brief High-level executor that manages task distribution to a ThreadPool.
  *
@@ -24,6 +68,60 @@ namespace tw {
  * - Topological sorting of tasks based on dependencies
  * - Task submission to the underlying thread pool
  *
+ * Dispatch Modes:
+ * - DispatchMode::Eager submits every task at once; a task whose inputs are not
+ *   ready parks its worker in IEdge::wait_until_retrievable()
+ * - DispatchMode::DependencyDriven keeps an atomic pending-predecessor counter per
+ *   task and only submits a task once its last scheduled predecessor completes,
+ *   so workers never sleep on dependencies
+ *
+ * Scheduling Policies (dependency-driven dispatch only):
+ * - SchedulingPolicy::Fifo submits each ready task to the pool directly
+ * - SchedulingPolicy::CriticalPath / WeightedCriticalPath put ready tasks in a
+ *   priority heap keyed by CompiledGraph::get_priority(); every pool job pops
+ *   the best ready task, so the longest remaining chain is always started first
+ *
+ * Continuations (dependency-driven dispatch only):
+ * - When a finished task makes successors ready, one of them (the first, or the
+ *   highest-priority one under a critical-path policy) runs immediately on the same
+ *   worker instead of going through the thread pool queue; the others are submitted
+ * - This skips a queue lock and a wakeup per link and keeps the producer's output
+ *   in cache; ExecutorOptions::max_continuation_depth bounds how many tasks one
+ *   pool job runs back to back before the next ready task is requeued
+ *
+ * Failure Handling:
+ * - A task whose callable throws ends Failed and its dependents skip execution
+ *   (see Task); get_failed_task() returns the first task that failed in the run
+ * - With ExecutorOptions::cancel_on_failure, the first failure stops the run (as
+ *   cancel() does), so a failed graph stops doing work right away
+ *
+ * Cancellation and Deadlines:
+ * - Every run has a std::stop_source; callables read its token with
+ *   this_task::get_stop_token() / this_task::stop_requested()
+ * - cancel(), a fail-fast failure, or the run deadline (ExecutorOptions::run_timeout,
+ *   enforced by the Watchdog thread) request a stop: tasks that have not started,
+ *   including ones blocked on their inputs, end Cancelled (TaskCancelled or
+ *   DeadlineExceeded) and release their dependents; running callables are expected
+ *   to poll the token and return early
+ * - Per-task start deadlines are set with ITask::set_deadline()
+ *
+ * NUMA Placement:
+ * - A task's ITask::set_numa_node() hint, or ExecutorOptions::numa_node for the
+ *   whole graph, queues it with IThreadPool::add_task_on_node(); NumaThreadPool
+ *   runs it on that node, other pools ignore the hint
+ * - A ready successor only runs as a continuation on the producer's worker if it
+ *   has the same node hint; otherwise it is submitted to its own node
+ * - Critical-path policies ignore the hints: any pool job may pick any ready task
+ *
+ * Dynamic Work:
+ * - current() returns the executor running the calling task, so a running task can
+ *   spawn() more jobs, or build a TaskGroup of child tasks, on the same thread pool
+ *
+ * Repeated Execution:
+ * - run(CompiledGraph&) executes a pre-compiled graph dependency-driven, skipping
+ *   reachability and sorting; the graph is reset before each run
+ * - The thread pool is created once and kept alive across runs
+ *
  * Usage:
  * @code
  * ThreadPoolExecutor executor;
@@ -42,6 +140,30 @@ public:
      */
     ThreadPoolExecutor() = default;
 
+    /**
+     * @brief Constructs an executor with the given options.
+     * @param options Executor configuration (dispatch mode, ...).
+     *
+     * Thread pool will be lazily created in run().
+     */
+    explicit ThreadPoolExecutor(const ExecutorOptions& options)
+        : options_(options)
+    {
+    }
+
+    /**
+     * @brief Constructs an executor on top of a caller-provided thread pool.
+     * @param pool Thread pool implementation (e.g. ThreadPool, WorkStealingThreadPool).
+     * @param options Executor configuration (dispatch mode, ...).
+     *
+     * The executor takes ownership of the pool and starts it in run().
+     */
+    explicit ThreadPoolExecutor(std::unique_ptr<IThreadPool> pool, const ExecutorOptions& options = {})
+        : pool_(std::move(pool))
+        , options_(options)
+    {
+    }
+
     /**
      * @brief Move constructor - transfers ownership from another executor.
      * @param other Executor to move from.
@@ -60,6 +182,16 @@ public:
     {
         pool_ = std::move(other.pool_);
         tasks_to_run_ = std::move(other.tasks_to_run_);
+        own_graph_ = std::move(other.own_graph_);
+        ready_heap_ = std::move(other.ready_heap_);
+        active_graph_ = other.active_graph_ == &other.own_graph_ ? &own_graph_ : other.active_graph_;
+        other.active_graph_ = nullptr;
+        failed_task_.store(other.failed_task_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        stop_source_ = std::move(other.stop_source_);
+        context_ = std::move(other.context_);
+        deadline_timer_ = std::move(other.deadline_timer_);
+        tracer_ = std::exchange(other.tracer_, nullptr);
+        options_ = other.options_;
         return *this;
     }
 
@@ -83,47 +215,176 @@ public:
      * @brief Prepares and submits all tasks to the thread pool for execution.
      *
      * This method:
-     * 1. Creates thread pool if not already created (uses hardware_concurrency)
+     * 1. Creates thread pool if not already created (elastic, up to hardware_concurrency)
      * 2. Computes reachability for automatic dependency detection
      * 3. Sorts tasks topologically based on dependencies
-     * 4. Submits all tasks to the thread pool
+     * 4. Submits all tasks (Eager) or only the ready ones (DependencyDriven) to the thread pool in one batch
      * 5. Starts worker threads
      *
      * @note Tasks with dependencies will execute only after their dependencies complete.
-     * @note Thread pool size defaults to std::thread::hardware_concurrency() if not set.
+     * @note In DependencyDriven mode, inward edges owned by tasks that were not added to this
+     *       executor are not tracked; such a task still waits for them inside its worker.
+     * @note Without a pool, an elastic ThreadPool of up to std::thread::hardware_concurrency() workers is used.
      */
     void run()
     {
-        if (pool_ == nullptr) {
-            pool_ = std::make_unique<ThreadPool>(std::thread::hardware_concurrency());
+        begin_run();
+        if (options_.dispatch_mode == DispatchMode::DependencyDriven) {
+            own_graph_ = CompiledGraph(tasks_to_run_);
+            if (options_.scheduling_policy == SchedulingPolicy::WeightedCriticalPath) {
+                own_graph_.compute_priorities(true);
+            }
+            launch(own_graph_);
         }
-        // Auto-compute reachability before sorting and execution
-        tw::compute_reachability(tasks_to_run_);
-        std::sort(tasks_to_run_.begin(), tasks_to_run_.end(), [](auto a, auto b) {
-            return *a < *b;
-        });
-        for (auto const& task : tasks_to_run_) {
-            pool_->add_task(std::function<void()>([task]() {
-                task->run();
-            }));
+        else {
+            // Auto-compute reachability before sorting and execution
+            tw::compute_reachability(tasks_to_run_);
+            std::sort(tasks_to_run_.begin(), tasks_to_run_.end(), [](auto a, auto b) {
+                return *a < *b;
+            });
+            const auto queued = trace_now();
+            auto jobs = tasks_to_run_ | std::views::transform([this, queued](ITask* task) {
+                            return [this, task, queued]() {
+                                CurrentScope scope{this};
+                                run_task(task, queued);
+                            };
+                        });
+            if (!has_numa_hints(tasks_to_run_)) {
+                pool_->add_tasks(jobs);
+            }
+            else {
+                // Per-task nodes: one submission each, still in topological order
+                for (size_t i = 0; i < tasks_to_run_.size(); i++) {
+                    submit(get_numa_node(tasks_to_run_[i]), jobs[i]);
+                }
+            }
         }
         pool_->run();
     }
 
     /**
-     * @brief Cancels all pending tasks in the queue.
+     * @brief Resets and executes a pre-compiled graph, dependency-driven.
+     * @param graph Graph to execute. Must outlive the run (until wait() returns).
      *
-     * Removes tasks that have been queued but not yet started execution.
-     * Does not affect tasks currently running or already completed.
+     * Tasks added with add_task() are not involved. The dispatch mode option is
+     * ignored: the graph always runs dependency-driven.
+     *
+     * @note Call wait() before running the same (or another) graph again.
+     * @note Without a pool, an elastic ThreadPool of up to std::thread::hardware_concurrency() workers is used.
+     */
+    void run(CompiledGraph& graph)
+    {
+        begin_run();
+        if (options_.scheduling_policy == SchedulingPolicy::WeightedCriticalPath) {
+            // Durations of the previous run, read before reset
+            graph.compute_priorities(true);
+        }
+        graph.reset();
+        launch(graph);
+        pool_->run();
+    }
+
+    /**
+     * @brief Submits a job to the thread pool, typically from inside a running task.
+     * @param fn Callable invocable with no arguments.
+     *
+     * The job runs with current() returning this executor, so it can spawn further
+     * work. wait() also waits for spawned jobs: they are queued while the spawning
+     * task is still active.
+     *
+     * @note Thread-safe. Creates the thread pool if needed, but does not start it.
+     */
+    template<typename Fn>
+    void spawn(Fn&& fn)
+    {
+        ensure_pool();
+        pool_->add_task([this, job = std::forward<Fn>(fn)]() mutable {
+            CurrentScope scope{this};
+            job();
+        });
+    }
+
+    /**
+     * @brief Returns the executor whose task or job is running on the calling thread.
+     * @return Executor pointer, or nullptr outside of executor jobs.
+     */
+    static auto current() noexcept -> ThreadPoolExecutor*
+    {
+        return current_;
+    }
+
+    /**
+     * @brief Returns the underlying thread pool.
+     * @return Pool pointer, or nullptr before the first run() / spawn().
+     */
+    auto get_pool() const noexcept -> IThreadPool*
+    {
+        return pool_.get();
+    }
+
+    /**
+     * @brief Returns the executor configuration.
+     * @return Options given at construction.
+     */
+    auto get_options() const noexcept -> const ExecutorOptions&
+    {
+        return options_;
+    }
+
+    /**
+     * @brief Attaches a tracer that records every task run by this executor.
+     * @param tracer Tracer to record into, or nullptr to stop tracing. Must outlive its runs.
+     *
+     * @note Call between runs (not while one is in flight).
+     */
+    void set_tracer(Tracer* tracer) noexcept
+    {
+        tracer_ = tracer;
+    }
+
+    /**
+     * @brief Returns the attached tracer.
+     * @return Tracer pointer, or nullptr if tracing is off.
+     */
+    auto get_tracer() const noexcept -> Tracer*
+    {
+        return tracer_;
+    }
+
+    /**
+     * @brief Returns the first task that failed in the current (or last) run.
+     * @return Failed task, or nullptr if every task completed so far.
+     *
+     * @note Read after wait(); the task's get_exception() holds the error.
+     */
+    auto get_failed_task() const noexcept -> ITask*
+    {
+        return failed_task_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the stop token of the current (or last) run.
+     * @return Token stopped by cancel(), a fail-fast failure or the run deadline.
+     */
+    auto get_stop_token() const noexcept -> std::stop_token
+    {
+        return context_.stop_token;
+    }
+
+    /**
+     * @brief Cancels the current run.
+     *
+     * Requests a stop on the run's stop source. Tasks that have not started are
+     * dropped as Cancelled when their job comes up (or at once, if blocked on an
+     * input), and their dependents are cancelled in turn, so every task of the run
+     * finishes and Task::wait() never blocks forever. Running callables keep going
+     * unless they poll this_task::stop_requested().
      *
      * @note Safe to call even if thread pool was not created.
      */
     void cancel()
     {
-        if (pool_ == nullptr) {
-            return;
-        }
-        pool_->clear_queued_tasks();
+        stop_source_.request_stop();
     }
 
     /**
@@ -139,10 +400,338 @@ public:
             return;
         }
         pool_->wait();
+        deadline_timer_.reset();
+    }
+
+private:
+    /**
+     * @brief Sets current() for the lifetime of a job, restoring the previous value.
+     *
+     * Jobs of another executor may run nested on the same thread (helping joins).
+     */
+    class CurrentScope {
+    public:
+        explicit CurrentScope(ThreadPoolExecutor* executor) noexcept
+            : previous_(std::exchange(current_, executor))
+            , context_scope_(&executor->context_)
+        {
+        }
+
+        ~CurrentScope()
+        {
+            current_ = previous_;
+        }
+
+        // Uncopyable class
+        CurrentScope(const CurrentScope&) = delete;
+        auto operator=(const CurrentScope&) -> CurrentScope& = delete;
+
+    private:
+        ThreadPoolExecutor* previous_;          ///< Executor to restore
+        detail::TaskContextScope context_scope_; ///< Stop token and deadline of the run
+    };
+
+    /**
+     * @brief Prepares a run: pool, fresh stop source, deadline and failure record.
+     */
+    void begin_run()
+    {
+        ensure_pool();
+        failed_task_.store(nullptr, std::memory_order_relaxed);
+        deadline_timer_.reset();
+        stop_source_ = std::stop_source{};
+        context_.stop_token = stop_source_.get_token();
+        context_.deadline = detail::TaskContext::TimePoint::max();
+        if (options_.run_timeout > std::chrono::nanoseconds::zero()) {
+            context_.deadline = std::chrono::steady_clock::now() + options_.run_timeout;
+            deadline_timer_ = Watchdog::Timer(context_.deadline, stop_source_);
+        }
+    }
+
+    /**
+     * @brief Creates the default thread pool if none was provided.
+     */
+    void ensure_pool()
+    {
+        if (pool_ == nullptr) {
+            pool_ = std::make_unique<ThreadPool>(ThreadPoolOptions{});
+        }
+    }
+
+    /**
+     * @brief Checks whether ready tasks go through the priority heap.
+     * @return true for the critical-path scheduling policies.
+     */
+    auto is_prioritized() const noexcept -> bool
+    {
+        return options_.scheduling_policy != SchedulingPolicy::Fifo;
+    }
+
+    /**
+     * @brief Makes the graph the active one and submits its root tasks in one batch.
+     * @param graph Compiled graph whose counters are in their initial state.
+     */
+    void launch(CompiledGraph& graph)
+    {
+        active_graph_ = &graph;
+        const auto queued = trace_now();
+        if (!is_prioritized()) {
+            auto jobs = graph.get_roots() | std::views::transform([this, queued](size_t i) {
+                            return [this, i, queued]() {
+                                execute(i, queued);
+                            };
+                        });
+            if (!has_numa_hints(graph.get_tasks())) {
+                pool_->add_tasks(jobs);
+                return;
+            }
+            for (auto root : graph.get_roots()) {
+                submit(get_numa_node(graph.get_task(root)), [this, root, queued]() {
+                    execute(root, queued);
+                });
+            }
+            return;
+        }
+
+        {
+            std::lock_guard lck{ready_mtx_};
+            // Leftovers of a cancelled run
+            ready_heap_.clear();
+            for (auto root : graph.get_roots()) {
+                push_ready(root);
+            }
+        }
+        pool_->add_tasks(graph.get_roots() | std::views::transform([this, queued](size_t) {
+                             return [this, queued]() {
+                                 execute_next_ready(queued);
+                             };
+                         }));
+    }
+
+    /**
+     * @brief Submits the task at the given index of the active graph to the thread pool.
+     * @param index Position of the task in the active graph.
+     *
+     * With a critical-path policy the task goes to the ready heap and the pool
+     * receives a job that runs whichever ready task has the highest priority.
+     */
+    void dispatch(size_t index)
+    {
+        const auto queued = trace_now();
+        if (!is_prioritized()) {
+            submit(get_numa_node(active_graph_->get_task(index)), [this, index, queued]() {
+                execute(index, queued);
+            });
+            return;
+        }
+
+        {
+            std::lock_guard lck{ready_mtx_};
+            push_ready(index);
+        }
+        pool_->add_task([this, queued]() {
+            execute_next_ready(queued);
+        });
+    }
+
+    /**
+     * @brief Returns the NUMA node a task should run on.
+     * @param task Task of the run.
+     * @return The task's own hint, else ExecutorOptions::numa_node.
+     */
+    auto get_numa_node(const ITask* task) const noexcept -> std::optional<uint32_t>
+    {
+        const auto node = task->get_numa_node();
+        return node ? node : options_.numa_node;
+    }
+
+    /**
+     * @brief Checks whether any task of the run carries a NUMA node hint.
+     * @param tasks Tasks of the run.
+     * @return true if tasks must be submitted one by one to their nodes.
+     */
+    auto has_numa_hints(std::span<ITask* const> tasks) const noexcept -> bool
+    {
+        return options_.numa_node.has_value() || std::ranges::any_of(tasks, [](const ITask* task) {
+                   return task->get_numa_node().has_value();
+               });
+    }
+
+    /**
+     * @brief Submits a job to the thread pool, on a NUMA node if one is given.
+     * @param node NUMA node, or std::nullopt for the pool's own placement.
+     * @param job Job to run.
+     */
+    template<typename Job>
+    void submit(std::optional<uint32_t> node, Job&& job)
+    {
+        if (node) {
+            pool_->add_task_on_node(*node, std::forward<Job>(job));
+        }
+        else {
+            pool_->add_task(std::forward<Job>(job));
+        }
+    }
+
+    /**
+     * @brief Returns the heap comparator for ready tasks.
+     * @return Comparator ordering task indices by ascending priority (max-heap on top).
+     */
+    auto ready_order() const noexcept
+    {
+        return [this](size_t a, size_t b) {
+            return active_graph_->get_priority(a) < active_graph_->get_priority(b);
+        };
+    }
+
+    /**
+     * @brief Pushes a ready task into the priority heap.
+     * @param index Position of the task in the active graph.
+     *
+     * @note Caller must hold ready_mtx_.
+     */
+    void push_ready(size_t index)
+    {
+        ready_heap_.push_back(index);
+        std::push_heap(ready_heap_.begin(), ready_heap_.end(), ready_order());
+    }
+
+    /**
+     * @brief Pops the ready task with the highest priority and executes it.
+     * @param queued Time the pool job was submitted (traced as the task's queue time).
+     *
+     * @note Called by worker threads only. Each pool job pops exactly one task,
+     *       so the heap is never empty when a job runs (unless a run was cancelled).
+     */
+    void execute_next_ready(Tracer::TimePoint queued)
+    {
+        size_t index = 0;
+        {
+            std::lock_guard lck{ready_mtx_};
+            if (ready_heap_.empty()) {
+                return;
+            }
+            std::pop_heap(ready_heap_.begin(), ready_heap_.end(), ready_order());
+            index = ready_heap_.back();
+            ready_heap_.pop_back();
+        }
+        execute(index, queued);
+    }
+
+    /**
+     * @brief Runs a task, then keeps running one ready successor inline, up to the continuation depth.
+     * @param index Position of the task in the active graph.
+     * @param queued Time the task was submitted (traced as its queue time).
+     *
+     * @note Called by worker threads only. Successors are submitted before this
+     *       job returns, so the pool never observes a spurious idle state.
+     */
+    void execute(size_t index, Tracer::TimePoint queued)
+    {
+        CurrentScope scope{this};
+        for (uint32_t depth = 0;; depth++) {
+            run_task(active_graph_->get_task(index), queued);
+            // A continuation was ready as soon as its successors were released
+            queued = trace_now();
+            const size_t next = release_successors(index, depth < options_.max_continuation_depth);
+            if (next == kNoContinuation) {
+                return;
+            }
+            index = next;
+        }
+    }
+
+    /**
+     * @brief Runs a task and records it if it fails; stops the run on failure if configured.
+     * @param task Task to run.
+     * @param queued Time the task was submitted, recorded if a tracer is attached.
+     *
+     * After a stop the task drops itself as Cancelled instead of running, and still
+     * completes its outward edge, so dependents finish as Cancelled too.
+     */
+    void run_task(ITask* task, Tracer::TimePoint queued)
+    {
+        if (tracer_ == nullptr) {
+            task->run();
+        }
+        else {
+            const auto begin = Tracer::Clock::now();
+            task->run();
+            const auto end = Tracer::Clock::now();
+            // A dropped task never reached its callable; its start time is from an earlier run
+            const auto start = task->get_start_time() >= begin ? task->get_start_time() : end;
+            tracer_->record(TraceEvent{.task = task,
+                                       .state = task->get_state(),
+                                       .queued = queued,
+                                       .begin = begin,
+                                       .start = start,
+                                       .end = end});
+        }
+        if (task->get_state() == TaskState::Failed) {
+            ITask* expected = nullptr;
+            failed_task_.compare_exchange_strong(expected, task, std::memory_order_acq_rel);
+            if (options_.cancel_on_failure) {
+                stop_source_.request_stop();
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current time if a tracer is attached.
+     * @return Now, or a default time point when tracing is off (no clock read).
+     */
+    auto trace_now() const noexcept -> Tracer::TimePoint
+    {
+        return tracer_ != nullptr ? Tracer::Clock::now() : Tracer::TimePoint{};
+    }
+
+    /**
+     * @brief Releases the successors of a finished task and submits the ones that became ready.
+     * @param index Position of the finished task in the active graph.
+     * @param can_continue Whether one ready successor may be kept for inline execution.
+     * @return Successor to run inline on this worker, or kNoContinuation.
+     */
+    auto release_successors(size_t index, bool can_continue) -> size_t
+    {
+        size_t continuation = kNoContinuation;
+        const auto node = get_numa_node(active_graph_->get_task(index));
+        for (auto successor : active_graph_->get_successors(index)) {
+            if (!active_graph_->release_predecessor(successor)) {
+                continue;
+            }
+            if (!can_continue || (!is_prioritized() && get_numa_node(active_graph_->get_task(successor)) != node)) {
+                dispatch(successor);
+            }
+            else if (continuation == kNoContinuation) {
+                continuation = successor;
+            }
+            else if (is_prioritized() &&
+                     active_graph_->get_priority(successor) > active_graph_->get_priority(continuation)) {
+                dispatch(continuation);
+                continuation = successor;
+            }
+            else {
+                dispatch(successor);
+            }
+        }
+        return continuation;
     }
 
 private:
-    std::unique_ptr<ThreadPool> pool_;          ///< Underlying thread pool
+    static constexpr size_t kNoContinuation = SIZE_MAX; ///< No successor to run inline
+    static inline thread_local ThreadPoolExecutor* current_ = nullptr; ///< Executor running the calling job
+
+    std::unique_ptr<IThreadPool> pool_;         ///< Underlying thread pool
     std::vector<ITask*> tasks_to_run_;          ///< Tasks pending execution
+    CompiledGraph own_graph_;                   ///< Graph compiled from tasks_to_run_ (DependencyDriven)
+    CompiledGraph* active_graph_ = nullptr;     ///< Graph currently dispatched dependency-driven
+    std::vector<size_t> ready_heap_;            ///< Ready task indices, max-heap on priority (critical-path policies)
+    std::mutex ready_mtx_;                      ///< Protects ready_heap_
+    std::atomic<ITask*> failed_task_{nullptr};  ///< First task that failed in the current run
+    std::stop_source stop_source_;              ///< Stop source of the current run
+    detail::TaskContext context_;               ///< Stop token and deadline installed around jobs
+    Watchdog::Timer deadline_timer_;            ///< Stops the run at its deadline (run_timeout)
+    Tracer* tracer_ = nullptr;                  ///< Records task runs, if attached
+    ExecutorOptions options_{};                 ///< Executor configuration
 };
 } // namespace tw
@@ -0,0 +1,392 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tw {
+
+/**
+ * @brief Parses a Linux CPU list such as "0-3,8,10-11".
+ * @param list Comma-separated CPU ids and inclusive ranges; surrounding whitespace is ignored.
+ * @return Sorted, unique CPU ids; malformed entries are skipped.
+ */
+inline auto parse_cpu_list(std::string_view list) -> std::vector<uint32_t>
+{
+    auto parse_id = [](std::string_view text, uint32_t& id) {
+        const auto* end = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), end, id);
+        return ec == std::errc{} && ptr == end;
+    };
+
+    std::vector<uint32_t> cpus;
+    while (!list.empty()) {
+        const size_t comma = list.find(',');
+        std::string_view entry = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+        const size_t first = entry.find_first_not_of(" \t\n");
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        entry = entry.substr(first, entry.find_last_not_of(" \t\n") - first + 1);
+
+        const size_t dash = entry.find('-');
+        uint32_t low = 0;
+        uint32_t high = 0;
+        if (dash == std::string_view::npos) {
+            if (!parse_id(entry, low)) {
+                continue;
+            }
+            high = low;
+        }
+        else if (!parse_id(entry.substr(0, dash), low) || !parse_id(entry.substr(dash + 1), high) || high < low) {
+            continue;
+        }
+        for (uint32_t cpu = low; cpu <= high; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::ranges::sort(cpus);
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+/**
+ * @brief Returns the CPUs the calling thread may run on.
+ * @return Sorted CPU ids of the affinity mask (the process cpuset in a container),
+ *         or an empty vector where affinity is not supported.
+ */
+inline auto get_thread_affinity() -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+/**
+ * @brief Restricts the calling thread to a set of CPUs.
+ * @param cpus CPU ids; a single id pins the thread to that CPU.
+ * @return true if the affinity was applied, false if cpus is empty, an id is
+ *         out of range or invalid, or affinity is not supported on this platform.
+ */
+inline auto set_thread_affinity(std::span<const uint32_t> cpus) noexcept -> bool
+{
+#if defined(__linux__)
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (uint32_t cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+/**
+ * @brief One logical CPU (hardware thread) and its place in the machine.
+ */
+struct CpuInfo {
+    uint32_t id = 0;         ///< Logical CPU id, as used by affinity masks
+    uint32_t core_id = 0;    ///< Physical core within the package; SMT siblings share it
+    uint32_t package_id = 0; ///< Socket
+    uint32_t numa_node = 0;  ///< NUMA node whose memory is local to the CPU
+
+    auto operator==(const CpuInfo&) const -> bool = default;
+};
+
+/**
+ * @brief Logical CPUs of the machine grouped by physical core, package and NUMA node.
+ *
+ * Discovered on Linux from /sys/devices/system/cpu (online list and per-CPU
+ * topology) and /sys/devices/system/node (per-node CPU lists). Elsewhere, or
+ * when sysfs cannot be read, detect() falls back to hardware_concurrency()
+ * CPUs on one core each in a single package and node.
+ *
+ * Usage:
+ * @code
+ * auto topology = CpuTopology::detect();
+ * ThreadPool pool(ThreadPoolOptions{.max_threads = topology.get_physical_cores().size(),
+ *                                   .pinning = WorkerPinning::PerPhysicalCore});
+ * @endcode
+ */
+class CpuTopology {
+public:
+    /**
+     * @brief Creates an empty topology.
+     */
+    CpuTopology() = default;
+
+    /**
+     * @brief Creates a topology from a list of CPUs.
+     * @param cpus CPUs in any order; they are sorted by id.
+     */
+    explicit CpuTopology(std::vector<CpuInfo> cpus)
+        : cpus_(std::move(cpus))
+    {
+        std::ranges::sort(cpus_, {}, &CpuInfo::id);
+    }
+
+    /**
+     * @brief Discovers the CPUs the calling thread may run on.
+     * @return Topology read from sysfs and restricted to the thread's affinity mask,
+     *         or the flat fallback if sysfs is not available.
+     */
+    static auto detect() -> CpuTopology
+    {
+        CpuTopology topology = from_sysfs("/sys/devices/system");
+        if (const auto allowed = get_thread_affinity(); !allowed.empty() && !topology.empty()) {
+            topology = topology.restricted_to(allowed);
+        }
+        if (topology.empty()) {
+            std::vector<CpuInfo> cpus;
+            const uint32_t count = std::max(std::thread::hardware_concurrency(), 1U);
+            for (uint32_t cpu = 0; cpu < count; cpu++) {
+                cpus.push_back(CpuInfo{.id = cpu, .core_id = cpu});
+            }
+            topology = CpuTopology(std::move(cpus));
+        }
+        return topology;
+    }
+
+    /**
+     * @brief Reads the topology from a sysfs tree.
+     * @param system_dir Directory holding the cpu/ and node/ trees (/sys/devices/system).
+     * @return Online CPUs with their core, package and node; empty if the CPU list cannot be read.
+     *
+     * @note Missing per-CPU files leave the defaults: the CPU is its own core in package 0, node 0.
+     */
+    static auto from_sysfs(const std::filesystem::path& system_dir) -> CpuTopology
+    {
+        const auto cpu_dir = system_dir / "cpu";
+        std::vector<uint32_t> online = parse_cpu_list(read_file(cpu_dir / "online"));
+        if (online.empty()) {
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(cpu_dir, ec)) {
+                uint32_t id = 0;
+                if (parse_indexed_name(entry.path().filename().string(), "cpu", id)) {
+                    online.push_back(id);
+                }
+            }
+            std::ranges::sort(online);
+        }
+
+        std::vector<CpuInfo> cpus;
+        cpus.reserve(online.size());
+        for (uint32_t id : online) {
+            const auto topology_dir = cpu_dir / ("cpu" + std::to_string(id)) / "topology";
+            cpus.push_back(CpuInfo{.id = id,
+                                   .core_id = read_id(topology_dir / "core_id", id),
+                                   .package_id = read_id(topology_dir / "physical_package_id", 0)});
+        }
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(system_dir / "node", ec)) {
+            uint32_t node = 0;
+            if (!parse_indexed_name(entry.path().filename().string(), "node", node)) {
+                continue;
+            }
+            for (uint32_t id : parse_cpu_list(read_file(entry.path() / "cpulist"))) {
+                auto it = std::ranges::find(cpus, id, &CpuInfo::id);
+                if (it != cpus.end()) {
+                    it->numa_node = node;
+                }
+            }
+        }
+        return CpuTopology(std::move(cpus));
+    }
+
+    /**
+     * @brief Returns a topology holding only the given CPUs.
+     * @param cpuset CPU ids to keep; ids not in this topology are ignored.
+     * @return Restricted topology.
+     */
+    auto restricted_to(std::span<const uint32_t> cpuset) const -> CpuTopology
+    {
+        std::vector<CpuInfo> cpus;
+        for (const auto& cpu : cpus_) {
+            if (std::ranges::find(cpuset, cpu.id) != cpuset.end()) {
+                cpus.push_back(cpu);
+            }
+        }
+        return CpuTopology(std::move(cpus));
+    }
+
+    /**
+     * @brief Returns all logical CPUs.
+     * @return CPUs sorted by id.
+     */
+    auto get_cpus() const noexcept -> const std::vector<CpuInfo>&
+    {
+        return cpus_;
+    }
+
+    /**
+     * @brief Returns the ids of all logical CPUs.
+     * @return Sorted CPU ids.
+     */
+    auto get_cpu_ids() const -> std::vector<uint32_t>
+    {
+        std::vector<uint32_t> ids;
+        ids.reserve(cpus_.size());
+        for (const auto& cpu : cpus_) {
+            ids.push_back(cpu.id);
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Returns one CPU per physical core, skipping SMT siblings.
+     * @return Lowest CPU id of every (package, core) pair, sorted.
+     */
+    auto get_physical_cores() const -> std::vector<uint32_t>
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> seen;
+        std::vector<uint32_t> ids;
+        for (const auto& cpu : cpus_) {
+            const std::pair core{cpu.package_id, cpu.core_id};
+            if (std::ranges::find(seen, core) == seen.end()) {
+                seen.push_back(core);
+                ids.push_back(cpu.id);
+            }
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Returns the NUMA nodes that have CPUs in this topology.
+     * @return Sorted node ids.
+     */
+    auto get_numa_nodes() const -> std::vector<uint32_t>
+    {
+        std::vector<uint32_t> nodes;
+        for (const auto& cpu : cpus_) {
+            nodes.push_back(cpu.numa_node);
+        }
+        std::ranges::sort(nodes);
+        nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+        return nodes;
+    }
+
+    /**
+     * @brief Returns the CPUs of one NUMA node.
+     * @param node NUMA node id.
+     * @return Sorted CPU ids; empty if the node has no CPU in this topology.
+     */
+    auto get_node_cpus(uint32_t node) const -> std::vector<uint32_t>
+    {
+        std::vector<uint32_t> ids;
+        for (const auto& cpu : cpus_) {
+            if (cpu.numa_node == node) {
+                ids.push_back(cpu.id);
+            }
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Returns the number of logical CPUs.
+     * @return CPU count.
+     */
+    auto size() const noexcept -> size_t
+    {
+        return cpus_.size();
+    }
+
+    /**
+     * @brief Checks whether the topology has no CPU.
+     * @return true if empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return cpus_.empty();
+    }
+
+private:
+    /**
+     * @brief Parses a sysfs directory name made of a prefix and an index, e.g. "cpu12".
+     * @param name Directory name.
+     * @param prefix Expected prefix ("cpu", "node").
+     * @param id Receives the index.
+     * @return true if name is the prefix followed by digits only.
+     */
+    static auto parse_indexed_name(std::string_view name, std::string_view prefix, uint32_t& id) -> bool
+    {
+        if (!name.starts_with(prefix) || name.size() == prefix.size()) {
+            return false;
+        }
+        const auto* end = name.data() + name.size();
+        auto [ptr, ec] = std::from_chars(name.data() + prefix.size(), end, id);
+        return ec == std::errc{} && ptr == end;
+    }
+
+    /**
+     * @brief Reads a sysfs attribute (first line).
+     * @param path File to read.
+     * @return File contents, or an empty string if it cannot be read.
+     */
+    static auto read_file(const std::filesystem::path& path) -> std::string
+    {
+        std::ifstream file(path);
+        std::string contents;
+        std::getline(file, contents);
+        return contents;
+    }
+
+    /**
+     * @brief Reads a numeric sysfs attribute.
+     * @param path File to read.
+     * @param fallback Value used if the file is missing or negative (e.g. a package id of -1).
+     * @return Parsed id or fallback.
+     */
+    static auto read_id(const std::filesystem::path& path, uint32_t fallback) -> uint32_t
+    {
+        const std::string contents = read_file(path);
+        uint32_t id = 0;
+        const auto* end = contents.data() + contents.size();
+        auto [ptr, ec] = std::from_chars(contents.data(), end, id);
+        return ec == std::errc{} ? id : fallback;
+    }
+
+private:
+    std::vector<CpuInfo> cpus_; ///< Logical CPUs sorted by id
+};
+
+} // namespace tw
@@ -0,0 +1,364 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "../TaskWeave/IEdge.h"
+#include "../TaskWeave/INode.h"
+#include "../TaskWeave/ITask.h"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief One traced execution of a task.
+ *
+ * The times nest: the task was queued, then picked by a thread (begin),
+ * waited for its inputs until start, and ran its callable until end. A task
+ * dropped before its callable (failed input, cancellation) has start == end.
+ */
+struct TraceEvent {
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    const ITask* task = nullptr;           ///< Traced task; must outlive the export
+    uint32_t thread = 0;                   ///< Ordinal of the recording thread, in registration order
+    TaskState state = TaskState::Complete; ///< State the task finished in
+    TimePoint queued{};                    ///< Submitted to the pool, or made ready for a continuation
+    TimePoint begin{};                     ///< Picked up by a thread
+    TimePoint start{};                     ///< Callable started (inputs ready)
+    TimePoint end{};                       ///< Finished
+};
+
+/**
+ * @brief Opt-in recorder of task executions, exported as a Chrome trace.
+ *
+ * Attach a Tracer to a ThreadPoolExecutor (set_tracer()) and every task run
+ * records a TraceEvent into a buffer owned by the recording thread: after the
+ * first event of a thread, recording takes no lock and shares no cache line
+ * with other threads. Once the run is over (after ThreadPoolExecutor::wait()),
+ * write_chrome_trace() writes the Chrome trace-event JSON that chrome://tracing
+ * and ui.perfetto.dev open:
+ * - One track per thread; each task is a slice with nested "wait inputs" and
+ *   "run" slices, and its queue wait, input wait and state as arguments
+ * - A flow arrow for every dependency edge between two traced tasks, from the
+ *   producer's slice to the consumer's
+ *
+ * Thread Safety:
+ * - record() is safe from any number of threads concurrently
+ * - get_events(), write_chrome_trace() and clear() must not overlap a run
+ *
+ * Usage:
+ * @code
+ * Tracer tracer;
+ * executor.set_tracer(&tracer);
+ * executor.run();
+ * executor.wait();
+ * tracer.save_chrome_trace("run.json");
+ * @endcode
+ */
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+public:
+    /**
+     * @brief Creates an empty tracer; trace timestamps count from its creation.
+     */
+    Tracer()
+        : id_(next_id_.fetch_add(1, std::memory_order_relaxed))
+        , epoch_(Clock::now())
+    {
+    }
+
+    // Uncopyable class
+    Tracer(const Tracer&) = delete;
+    auto operator=(const Tracer&) -> Tracer& = delete;
+
+    // Unmovable class
+    Tracer(Tracer&&) = delete;
+    auto operator=(Tracer&&) -> Tracer& = delete;
+
+    /**
+     * @brief Records one task execution into the calling thread's buffer.
+     * @param event Execution to record; its thread field is filled in.
+     *
+     * @note Lock-free after the first call on each thread.
+     */
+    auto record(TraceEvent event) -> void
+    {
+        ThreadBuffer& buffer = get_thread_buffer();
+        event.thread = buffer.thread;
+        buffer.events.push_back(event);
+    }
+
+    /**
+     * @brief Returns every recorded event.
+     * @return Events of all threads, ordered by begin time.
+     */
+    auto get_events() const -> std::vector<TraceEvent>
+    {
+        std::vector<TraceEvent> events;
+        std::lock_guard lck{mtx_};
+        for (const auto& buffer : buffers_) {
+            events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+        }
+        std::ranges::sort(events, {}, &TraceEvent::begin);
+        return events;
+    }
+
+    /**
+     * @brief Drops the recorded events; threads keep their buffers and ordinals.
+     */
+    auto clear() -> void
+    {
+        std::lock_guard lck{mtx_};
+        for (auto& buffer : buffers_) {
+            buffer->events.clear();
+        }
+    }
+
+    /**
+     * @brief Writes the recorded events as Chrome trace-event JSON.
+     * @param out Stream to write to.
+     */
+    auto write_chrome_trace(std::ostream& out) const -> void
+    {
+        const auto events = get_events();
+        const auto flags = out.flags();
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << R"({"ph":"M","name":"process_name","pid":1,"tid":0,"args":{"name":"TaskWeave"}})";
+
+        uint32_t thread_count = 0;
+        for (const auto& event : events) {
+            thread_count = std::max(thread_count, event.thread + 1);
+        }
+        for (uint32_t thread = 0; thread < thread_count; thread++) {
+            out << ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << thread
+                << R"(,"args":{"name":"thread )" << thread << "\"}}";
+        }
+
+        // Latest execution of every traced node, for the dependency flows
+        std::unordered_map<const INode*, const TraceEvent*> by_node;
+        for (const auto& event : events) {
+            by_node[event.task->as_node()] = &event;
+        }
+
+        uint64_t flow_id = 0;
+        for (const auto& event : events) {
+            const std::string name = get_display_name(*event.task);
+            out << ",\n{\"ph\":\"X\",\"cat\":\"task\",\"name\":\"" << escape(name) << "\",\"pid\":1,\"tid\":"
+                << event.thread << ",\"ts\":" << to_us(event.begin) << ",\"dur\":" << to_us(event.end, event.begin)
+                << ",\"args\":{\"queue_wait_us\":" << to_us(event.begin, event.queued)
+                << ",\"input_wait_us\":" << to_us(event.start, event.begin) << ",\"state\":\""
+                << to_string(event.state) << "\"}}";
+            if (event.start > event.begin) {
+                write_slice(out, "wait inputs", event.thread, event.begin, event.start);
+            }
+            if (event.end > event.start) {
+                write_slice(out, "run", event.thread, event.start, event.end);
+            }
+
+            for (const IEdge* edge : event.task->as_node()->get_inward_edges()) {
+                if (edge == nullptr) {
+                    continue;
+                }
+                auto producer = by_node.find(edge->get_owner());
+                if (producer == by_node.end()) {
+                    continue;
+                }
+                const TraceEvent& from = *producer->second;
+                out << ",\n{\"ph\":\"s\",\"cat\":\"dependency\",\"name\":\"edge\",\"id\":" << flow_id
+                    << ",\"pid\":1,\"tid\":" << from.thread << ",\"ts\":" << to_us(from.begin) << "}";
+                out << ",\n{\"ph\":\"f\",\"bp\":\"e\",\"cat\":\"dependency\",\"name\":\"edge\",\"id\":" << flow_id
+                    << ",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":" << to_us(event.begin) << "}";
+                flow_id++;
+            }
+        }
+        out << "\n]}\n";
+        out.flags(flags);
+    }
+
+    /**
+     * @brief Writes the Chrome trace to a file.
+     * @param path File to create or overwrite.
+     * @return true if the file was written.
+     */
+    auto save_chrome_trace(const std::filesystem::path& path) const -> bool
+    {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+        write_chrome_trace(file);
+        return static_cast<bool>(file);
+    }
+
+private:
+    /**
+     * @brief Events of one recording thread; written by that thread only.
+     */
+    struct ThreadBuffer {
+        std::thread::id owner;          ///< Recording thread
+        uint32_t thread = 0;            ///< Ordinal of the thread in this tracer
+        std::vector<TraceEvent> events; ///< Recorded events
+    };
+
+    /**
+     * @brief Thread-local pointer to the buffer of the last tracer the thread recorded into.
+     *
+     * @note Zero-initialized as a thread_local: tracer id 0 is never assigned.
+     */
+    struct BufferCache {
+        uint64_t tracer_id;   ///< Tracer the buffer belongs to (ids are never reused)
+        ThreadBuffer* buffer; ///< Buffer of the calling thread in that tracer
+    };
+
+    /**
+     * @brief Returns the calling thread's buffer, registering it on first use.
+     * @return Buffer owned by this tracer.
+     */
+    auto get_thread_buffer() -> ThreadBuffer&
+    {
+        if (cache_.tracer_id == id_) {
+            return *cache_.buffer;
+        }
+        std::lock_guard lck{mtx_};
+        const auto owner = std::this_thread::get_id();
+        auto it = std::ranges::find(buffers_, owner, &ThreadBuffer::owner);
+        ThreadBuffer* buffer = nullptr;
+        if (it != buffers_.end()) {
+            buffer = it->get();
+        }
+        else {
+            auto created = std::make_unique<ThreadBuffer>();
+            created->owner = owner;
+            created->thread = static_cast<uint32_t>(buffers_.size());
+            buffer = created.get();
+            buffers_.push_back(std::move(created));
+        }
+        cache_ = BufferCache{.tracer_id = id_, .buffer = buffer};
+        return *buffer;
+    }
+
+    /**
+     * @brief Writes a nested slice of a task.
+     */
+    auto write_slice(std::ostream& out, std::string_view name, uint32_t thread, TimePoint from, TimePoint to) const
+        -> void
+    {
+        out << ",\n{\"ph\":\"X\",\"cat\":\"task\",\"name\":\"" << name << "\",\"pid\":1,\"tid\":" << thread
+            << ",\"ts\":" << to_us(from) << ",\"dur\":" << to_us(to, from) << "}";
+    }
+
+    /**
+     * @brief Converts a time point to microseconds since the tracer was created.
+     */
+    auto to_us(TimePoint time) const -> double
+    {
+        return to_us(time, epoch_);
+    }
+
+    /**
+     * @brief Converts the distance between two time points to microseconds (0 if negative).
+     */
+    static auto to_us(TimePoint to, TimePoint from) -> double
+    {
+        return to > from ? std::chrono::duration<double, std::micro>(to - from).count() : 0.0;
+    }
+
+    /**
+     * @brief Returns the task name, or its address if it has none.
+     */
+    static auto get_display_name(const ITask& task) -> std::string
+    {
+        if (!task.get_name().empty()) {
+            return std::string(task.get_name());
+        }
+        std::ostringstream name;
+        name << "task " << static_cast<const void*>(&task);
+        return name.str();
+    }
+
+    /**
+     * @brief Returns the name of a final task state.
+     */
+    static auto to_string(TaskState state) -> std::string_view
+    {
+        switch (state) {
+        case TaskState::Complete:
+            return "Complete";
+        case TaskState::Failed:
+            return "Failed";
+        case TaskState::Cancelled:
+            return "Cancelled";
+        default:
+            return "Unfinished";
+        }
+    }
+
+    /**
+     * @brief Escapes a string for a JSON string literal.
+     */
+    static auto escape(std::string_view text) -> std::string
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text) {
+            switch (c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    std::ostringstream code;
+                    code << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                    escaped += code.str();
+                }
+                else {
+                    escaped += c;
+                }
+            }
+        }
+        return escaped;
+    }
+
+private:
+    static inline std::atomic<uint64_t> next_id_{1}; ///< Source of tracer ids
+    static inline thread_local BufferCache cache_;   ///< Last buffer used by the calling thread
+
+    uint64_t id_;                                        ///< Unique id, keys the thread-local cache
+    TimePoint epoch_;                                    ///< Time zero of the trace
+    mutable std::mutex mtx_;                             ///< Protects buffers_ (registration and export)
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_; ///< One buffer per recording thread
+};
+
+} // namespace tw
@@ -0,0 +1,223 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Lock-free single-owner, multi-thief deque (Chase-Lev).
+ *
+ * The owner thread pushes and pops at the bottom (LIFO), while any other
+ * thread may steal from the top (FIFO). The buffer grows on demand; retired
+ * buffers are kept alive until destruction since a thief may still be reading
+ * from them.
+ *
+ * Based on "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+ *
+ * @tparam T Element type. Must be trivially copyable (typically a pointer).
+ *
+ * Thread Safety:
+ * - push() and pop() must only be called by the owner thread
+ * - steal() may be called concurrently from any thread
+ * - size() and empty() are lock-free snapshots and may be stale
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable.");
+
+private:
+    /**
+     * @brief Power-of-two circular array of atomic slots.
+     */
+    struct Buffer {
+        explicit Buffer(size_t capacity)
+            : capacity(capacity)
+            , mask(capacity - 1)
+            , slots(std::make_unique<std::atomic<T>[]>(capacity))
+        {
+        }
+
+        auto get(int64_t index) const noexcept -> T
+        {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        auto put(int64_t index, T value) noexcept -> void
+        {
+            slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+
+        size_t capacity;                        ///< Number of slots (power of two)
+        size_t mask;                            ///< capacity - 1
+        std::unique_ptr<std::atomic<T>[]> slots; ///< Element storage
+    };
+
+public:
+    /**
+     * @brief Constructs an empty deque.
+     * @param capacity Initial capacity, rounded up to a power of two.
+     */
+    explicit WorkStealingDeque(size_t capacity = 64)
+    {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        retired_.emplace_back(std::make_unique<Buffer>(rounded));
+        buffer_.store(retired_.back().get(), std::memory_order_relaxed);
+    }
+
+    // Uncopyable class
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    auto operator=(const WorkStealingDeque&) -> WorkStealingDeque& = delete;
+
+    // Unmovable class
+    WorkStealingDeque(WorkStealingDeque&&) noexcept = delete;
+    auto operator=(WorkStealingDeque&&) noexcept -> WorkStealingDeque& = delete;
+
+    /**
+     * @brief Pushes an element at the bottom of the deque.
+     * @param value Element to push.
+     *
+     * @note Owner thread only. Grows the buffer when full.
+     */
+    auto push(T value) -> void
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+        buffer->put(bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pops the most recently pushed element.
+     * @return The element, or std::nullopt if the deque is empty or the last
+     *         element was lost to a concurrent thief.
+     *
+     * @note Owner thread only.
+     */
+    auto pop() noexcept -> std::optional<T>
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Deque was already empty
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T value = buffer->get(bottom);
+        if (top == bottom) {
+            // Single element left: race against thieves for it
+            const bool won =
+                top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Steals the oldest element.
+     * @return The element, or std::nullopt if the deque is empty or another
+     *         thread won the race for the element.
+     *
+     * @note Thread-safe: may be called from any thread.
+     */
+    auto steal() noexcept -> std::optional<T>
+    {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T value = buffer->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the approximate number of elements.
+     * @return Element count snapshot.
+     */
+    auto size() const noexcept -> size_t
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    /**
+     * @brief Checks whether the deque appears empty.
+     * @return true if no elements were observed.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the current buffer capacity.
+     * @return Number of slots in the active buffer.
+     */
+    auto capacity() const noexcept -> size_t
+    {
+        return buffer_.load(std::memory_order_relaxed)->capacity;
+    }
+
+private:
+    /**
+     * @brief Doubles the buffer, copying live elements.
+     * @return The new active buffer.
+     *
+     * @note Owner thread only. The old buffer is retained until destruction.
+     */
+    auto grow(Buffer* old_buffer, int64_t bottom, int64_t top) -> Buffer*
+    {
+        auto new_buffer = std::make_unique<Buffer>(old_buffer->capacity * 2);
+        for (int64_t i = top; i < bottom; i++) {
+            new_buffer->put(i, old_buffer->get(i));
+        }
+        Buffer* raw = new_buffer.get();
+        retired_.emplace_back(std::move(new_buffer));
+        buffer_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> top_{0};        ///< Steal end (thieves)
+    alignas(64) std::atomic<int64_t> bottom_{0};     ///< Push/pop end (owner)
+    alignas(64) std::atomic<Buffer*> buffer_{};      ///< Active buffer
+    std::vector<std::unique_ptr<Buffer>> retired_;   ///< All buffers ever allocated (owned)
+};
+
+} // namespace tw
@@ -0,0 +1,515 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "IThreadPool.h"
+#include "WorkStealingDeque.h"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief A fixed-size thread pool where every worker owns a lock-free deque.
+ *
+ * WorkStealingThreadPool is a drop-in alternative to ThreadPool that removes
+ * the single shared queue from the hot path:
+ * - Tasks submitted from one of its workers go to that worker's local deque
+ * - Tasks submitted from other threads go to a shared injection queue
+ * - A worker pops its own deque first (LIFO, cache-hot), then drains the
+ *   injection queue, then steals (FIFO) from randomly chosen victims
+ * - Workers with nothing to do park on a condition variable
+ * - Task nodes released on a worker are recycled through a worker-local free
+ *   list, so spawning from inside a task does not allocate
+ *
+ * Thread Safety:
+ * - Local deques are Chase-Lev deques (owner push/pop, any-thread steal)
+ * - Injection queue is protected by a mutex
+ * - Active and queued task counts are atomic for lock-free queries
+ *
+ * Usage:
+ * @code
+ * WorkStealingThreadPool pool{4};
+ * pool.run();
+ * pool.add_task([&pool]{ pool.add_task([]{ <child logic> }); });
+ * pool.wait();
+ * @endcode
+ */
+class WorkStealingThreadPool : public IThreadPool {
+public:
+    /**
+     * @brief Constructs a WorkStealingThreadPool with specified worker count.
+     * @param thread_count Number of worker threads to spawn.
+     * @param on_complete_callback Optional callback invoked when all tasks complete.
+     */
+    explicit WorkStealingThreadPool(size_t thread_count, const std::function<void()>& on_complete_callback = nullptr)
+        : on_complete_(on_complete_callback)
+        , thread_count_(thread_count)
+    {
+        workers_.reserve(thread_count_);
+        for (size_t i = 0; i < thread_count_; i++) {
+            workers_.emplace_back(std::make_unique<Worker>());
+        }
+    }
+
+    /**
+     * @brief Destructor - initiates shutdown, joins workers and frees unexecuted tasks.
+     */
+    ~WorkStealingThreadPool() override
+    {
+        {
+            std::lock_guard lck{sleep_mtx_};
+            is_shutting_down_.store(true, std::memory_order_release);
+        }
+        sleep_cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+        drain_queued_tasks();
+    }
+
+    // Uncopyable class
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    auto operator=(const WorkStealingThreadPool&) -> WorkStealingThreadPool& = delete;
+
+    // Unmovable class
+    WorkStealingThreadPool(WorkStealingThreadPool&& other) noexcept = delete;
+    auto operator=(WorkStealingThreadPool&& other) noexcept -> WorkStealingThreadPool& = delete;
+
+    /**
+     * @brief Clears all pending tasks from every deque and the injection queue.
+     *
+     * Reduces active task count by the number of cleared tasks and wakes
+     * waiters if the pool became idle. Does not affect running tasks.
+     *
+     * @note Thread-safe: steals from every deque.
+     */
+    auto clear_queued_tasks() -> void override
+    {
+        const size_t cleared = drain_queued_tasks();
+        if (cleared > 0) {
+            complete_tasks(static_cast<int>(cleared));
+        }
+    }
+
+    /**
+     * @brief Spawns worker threads and begins task processing.
+     *
+     * @note Not thread-safe: should be called once. Subsequent calls are no-ops.
+     */
+    auto run() noexcept -> void override
+    {
+        if (is_running_) {
+            return;
+        }
+        is_running_ = true;
+        for (size_t i = 0; i < thread_count_; i++) {
+            workers_[i]->thread = std::thread([this, i]() {
+                worker_loop(i);
+            });
+        }
+    }
+
+    /**
+     * @brief Blocks until all submitted tasks have completed execution.
+     *
+     * @note Thread-safe: uses dedicated wait mutex.
+     */
+    auto wait() const noexcept -> void override
+    {
+        std::unique_lock lck(wait_mtx_);
+        wait_cv_.wait(lck, [this]() {
+            return is_idle();
+        });
+    }
+
+    /**
+     * @brief Runs one queued task on the calling thread, if any.
+     * @return true if a task was executed.
+     *
+     * A worker of this pool looks in its own deque first, then the injection queue,
+     * then steals; any other thread drains the injection queue, then steals.
+     *
+     * @note Thread-safe.
+     */
+    auto try_execute_one() -> bool override
+    {
+        TaskFunction* task = nullptr;
+        if (current_pool_ == this) {
+            uint64_t rng_state = (0x9E3779B97F4A7C15ULL * (current_worker_index_ + 1)) ^ helper_rng_state_++;
+            task = find_task(current_worker_index_, rng_state);
+        }
+        else if ((task = pop_injection_queue()) == nullptr) {
+            for (auto& worker : workers_) {
+                if (auto stolen = worker->deque.steal()) {
+                    task = *stolen;
+                    break;
+                }
+            }
+        }
+        if (task == nullptr) {
+            return false;
+        }
+        queued_task_count_.fetch_sub(1, std::memory_order_acq_rel);
+        execute_task(task);
+        return true;
+    }
+
+    /**
+     * @brief Checks if the thread pool has no active tasks.
+     * @return true if no tasks are currently executing or queued.
+     *
+     * @note Lock-free: uses atomic load with acquire semantics.
+     */
+    auto is_idle() const noexcept -> bool override
+    {
+        return active_task_count_.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @brief Returns the count of currently active tasks.
+     * @return Number of tasks being executed or waiting in a queue.
+     *
+     * @note Lock-free: uses atomic load with acquire semantics.
+     */
+    auto active_task_count() const noexcept -> int override
+    {
+        return active_task_count_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if all queues are empty.
+     * @return true if no tasks are waiting in any queue.
+     *
+     * @note Lock-free snapshot; may be stale.
+     */
+    auto empty() const noexcept -> bool override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the number of queued tasks across all queues.
+     * @return Count of pending tasks (not including executing tasks).
+     *
+     * @note Lock-free snapshot; may be stale.
+     */
+    auto size() const noexcept -> size_t override
+    {
+        const auto count = queued_task_count_.load(std::memory_order_acquire);
+        return count > 0 ? static_cast<size_t>(count) : 0;
+    }
+
+    /**
+     * @brief Returns the configured number of worker threads.
+     * @return Thread count specified at construction.
+     */
+    auto worker_count() const noexcept -> size_t override
+    {
+        return thread_count_;
+    }
+
+protected:
+    /**
+     * @brief Queues a task on the calling worker's deque, or the injection queue.
+     * @param task Task to execute on a worker thread.
+     *
+     * @note Thread-safe. Wakes a parked worker if any.
+     */
+    auto enqueue(TaskFunction task) -> void override
+    {
+        auto* item = acquire_node(std::move(task));
+        active_task_count_.fetch_add(1, std::memory_order_acq_rel);
+        queued_task_count_.fetch_add(1, std::memory_order_seq_cst);
+
+        if (current_pool_ == this) {
+            workers_[current_worker_index_]->deque.push(item);
+        }
+        else {
+            std::lock_guard lck{injection_mtx_};
+            injection_queue_.push_back(item);
+        }
+
+        if (sleeping_count_.load(std::memory_order_seq_cst) > 0) {
+            {
+                std::lock_guard lck{sleep_mtx_};
+            }
+            sleep_cv_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Queues a batch of tasks with a single injection-queue lock (or local pushes).
+     * @param tasks Non-empty span of tasks; elements are moved from.
+     *
+     * Wakes at most min(N, parked workers) threads.
+     *
+     * @note Thread-safe.
+     */
+    auto enqueue_batch(std::span<TaskFunction> tasks) -> void override
+    {
+        const auto count = static_cast<int64_t>(tasks.size());
+        active_task_count_.fetch_add(static_cast<int>(count), std::memory_order_acq_rel);
+        queued_task_count_.fetch_add(count, std::memory_order_seq_cst);
+
+        if (current_pool_ == this) {
+            auto& deque = workers_[current_worker_index_]->deque;
+            for (auto& task : tasks) {
+                deque.push(acquire_node(std::move(task)));
+            }
+        }
+        else {
+            std::lock_guard lck{injection_mtx_};
+            for (auto& task : tasks) {
+                injection_queue_.push_back(acquire_node(std::move(task)));
+            }
+        }
+
+        const auto sleeping = static_cast<size_t>(sleeping_count_.load(std::memory_order_seq_cst));
+        if (sleeping > 0) {
+            {
+                std::lock_guard lck{sleep_mtx_};
+            }
+            const size_t to_wake = std::min(tasks.size(), sleeping);
+            if (to_wake == sleeping) {
+                sleep_cv_.notify_all();
+            }
+            else {
+                for (size_t i = 0; i < to_wake; i++) {
+                    sleep_cv_.notify_one();
+                }
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Per-worker state.
+     */
+    struct Worker {
+        ~Worker()
+        {
+            for (auto* node : free_nodes) {
+                delete node;
+            }
+        }
+
+        WorkStealingDeque<TaskFunction*> deque; ///< Local tasks (owner push/pop, others steal)
+        std::vector<TaskFunction*> free_nodes;  ///< Recycled empty task nodes (owner only)
+        std::thread thread;                     ///< Worker thread handle
+    };
+
+    static constexpr size_t kMaxFreeNodes = 1024; ///< Per-worker cap on recycled task nodes
+
+    /**
+     * @brief Obtains a task node, reusing one from the calling worker's free list when possible.
+     * @param task Task to store in the node.
+     * @return Node owning the task.
+     */
+    auto acquire_node(TaskFunction&& task) -> TaskFunction*
+    {
+        if (current_pool_ == this) {
+            auto& free_nodes = workers_[current_worker_index_]->free_nodes;
+            if (!free_nodes.empty()) {
+                auto* node = free_nodes.back();
+                free_nodes.pop_back();
+                *node = std::move(task);
+                return node;
+            }
+        }
+        return new TaskFunction(std::move(task));
+    }
+
+    /**
+     * @brief Destroys a node's task and returns the node to the calling worker's free list.
+     * @param node Node taken from a queue.
+     *
+     * @note Nodes released from non-worker threads (or beyond the cap) are freed.
+     */
+    auto release_node(TaskFunction* node) -> void
+    {
+        if (current_pool_ == this) {
+            auto& free_nodes = workers_[current_worker_index_]->free_nodes;
+            if (free_nodes.size() < kMaxFreeNodes) {
+                *node = nullptr;
+                free_nodes.push_back(node);
+                return;
+            }
+        }
+        delete node;
+    }
+
+    /**
+     * @brief Main loop of a worker thread.
+     * @param index Index of the worker in workers_.
+     */
+    auto worker_loop(size_t index) -> void
+    {
+        current_pool_ = this;
+        current_worker_index_ = index;
+        uint64_t rng_state = 0x9E3779B97F4A7C15ULL * (index + 1);
+
+        while (!is_shutting_down_.load(std::memory_order_acquire)) {
+            if (auto* task = find_task(index, rng_state)) {
+                queued_task_count_.fetch_sub(1, std::memory_order_acq_rel);
+                execute_task(task);
+                continue;
+            }
+
+            std::unique_lock lck{sleep_mtx_};
+            sleeping_count_.fetch_add(1, std::memory_order_seq_cst);
+            sleep_cv_.wait(lck, [this]() {
+                return queued_task_count_.load(std::memory_order_seq_cst) > 0 ||
+                       is_shutting_down_.load(std::memory_order_acquire);
+            });
+            sleeping_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        current_pool_ = nullptr;
+    }
+
+    /**
+     * @brief Looks for a task: local deque, then injection queue, then random victims.
+     * @param index Index of the calling worker.
+     * @param rng_state Worker-local xorshift state used to pick victims.
+     * @return A task to run, or nullptr if none was found.
+     */
+    auto find_task(size_t index, uint64_t& rng_state) -> TaskFunction*
+    {
+        if (auto task = workers_[index]->deque.pop()) {
+            return *task;
+        }
+        if (auto task = pop_injection_queue()) {
+            return task;
+        }
+        if (thread_count_ < 2) {
+            return nullptr;
+        }
+        for (size_t attempt = 0; attempt < thread_count_ * 2; attempt++) {
+            rng_state ^= rng_state << 13;
+            rng_state ^= rng_state >> 7;
+            rng_state ^= rng_state << 17;
+            const size_t victim = static_cast<size_t>(rng_state % thread_count_);
+            if (victim == index) {
+                continue;
+            }
+            if (auto task = workers_[victim]->deque.steal()) {
+                return *task;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Pops the oldest task from the injection queue.
+     * @return A task, or nullptr if the queue is empty.
+     */
+    auto pop_injection_queue() -> TaskFunction*
+    {
+        std::lock_guard lck{injection_mtx_};
+        if (injection_queue_.empty()) {
+            return nullptr;
+        }
+        auto* task = injection_queue_.front();
+        injection_queue_.pop_front();
+        return task;
+    }
+
+    /**
+     * @brief Runs and releases a task, then updates completion accounting.
+     * @param task Task node taken from a queue.
+     */
+    auto execute_task(TaskFunction* task) -> void
+    {
+        (*task)();
+        release_node(task);
+        complete_tasks(1);
+    }
+
+    /**
+     * @brief Decrements the active count and notifies waiters on reaching zero.
+     * @param count Number of tasks that finished or were discarded.
+     *
+     * Lock-free unless the count reaches zero: only the thread observing that
+     * transition takes wait_mtx_ (so a waiter cannot miss the notification).
+     */
+    auto complete_tasks(int count) -> void
+    {
+        if (active_task_count_.fetch_sub(count, std::memory_order_acq_rel) != count) {
+            return;
+        }
+        std::lock_guard lck{wait_mtx_};
+        if (on_complete_) {
+            on_complete_();
+        }
+        wait_cv_.notify_all();
+    }
+
+    /**
+     * @brief Removes and frees every queued task.
+     * @return Number of tasks removed.
+     */
+    auto drain_queued_tasks() -> size_t
+    {
+        std::deque<TaskFunction*> injected;
+        {
+            std::lock_guard lck{injection_mtx_};
+            injected.swap(injection_queue_);
+        }
+        // Released outside the lock: a destroyed task may submit a new one
+        for (auto* task : injected) {
+            release_node(task);
+        }
+        size_t cleared = injected.size();
+        for (auto& worker : workers_) {
+            while (!worker->deque.empty()) {
+                if (auto task = worker->deque.steal()) {
+                    release_node(*task);
+                    cleared++;
+                }
+            }
+        }
+        queued_task_count_.fetch_sub(static_cast<int64_t>(cleared), std::memory_order_acq_rel);
+        return cleared;
+    }
+
+private:
+    static inline thread_local WorkStealingThreadPool* current_pool_ = nullptr; ///< Pool owning the calling worker
+    static inline thread_local size_t current_worker_index_ = 0;                ///< Index of the calling worker
+    static inline thread_local uint64_t helper_rng_state_ = 0;                  ///< Varies victims across try_execute_one() calls
+
+    std::vector<std::unique_ptr<Worker>> workers_;     ///< Worker states (deque + thread)
+    std::deque<TaskFunction*> injection_queue_;        ///< Tasks submitted from non-worker threads
+    std::mutex injection_mtx_;                         ///< Protects injection queue
+    std::mutex sleep_mtx_;                             ///< Protects parking of idle workers
+    std::condition_variable sleep_cv_;                 ///< Wakes parked workers
+    mutable std::mutex wait_mtx_;                      ///< Protects wait condition
+    mutable std::condition_variable wait_cv_;          ///< Notifies waiters when idle
+    std::function<void()> on_complete_;                ///< Callback when all tasks complete
+    std::atomic<int> active_task_count_{0};            ///< Count of active/pending tasks
+    std::atomic<int64_t> queued_task_count_{0};        ///< Count of tasks sitting in any queue
+    std::atomic<int> sleeping_count_{0};               ///< Count of parked workers
+    std::atomic<bool> is_shutting_down_{false};        ///< Shutdown flag
+    size_t thread_count_{};                            ///< Configured worker count
+    bool is_running_ = false;                          ///< Whether workers were spawned
+};
+
+} // namespace tw
@@ -8,21 +8,43 @@
 #include "INode.h"
 
 // STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <ranges>
+#include <span>
+#include <utility>
 
 namespace tw {
 
+/**
+ * @brief How consumers receive the data of an Edge.
+ */
+enum class EdgeTransferMode : uint32_t {
+    Copy,               ///< Every consumer receives a copy; the edge keeps the data
+    MoveToLastConsumer, ///< The last registered consumer to read moves the data out of the edge
+};
+
 /**
  * @brief Edge class that carries data between task nodes.
  *
  * Edge is a templated class that encapsulates data passed from one task to another.
  * It provides thread-safe data transfer with synchronization:
- * - Producer tasks call set_data() to write data and mark it as retrievable
- * - Consumer tasks call get_data() to retrieve the data (after waiting if needed)
+ * - Producer tasks call set_data() to write (copy or move) data and mark it as retrievable
+ * - Consumer tasks call get_data() / get_data_ref() / get_data_span() to read the data
+ *   (after waiting if needed), or take_data() to receive their own value
+ *
+ * Ownership:
+ * - The edge is the single owner of a task's result (Task::get_result() reads it)
+ * - Nodes register themselves as consumers when the edge is added as an inward edge
+ * - In EdgeTransferMode::MoveToLastConsumer, take_data() moves the data out for the
+ *   consumer that reads last, so a single-consumer edge never copies
  *
  * @tparam T The type of data carried by the edge.
  *
  * Thread Safety:
- * - Uses IEdge's condition variable and mutex for synchronization
+ * - Uses IEdge's atomic retrievable flag (wait/notify) for synchronization
  * - wait_until_retrievable() blocks until set_data() is called
  *
  * Usage:
@@ -54,14 +76,53 @@ public:
      * 2. Marks the edge as retrievable (via set_as_retrievable)
      * 3. Notifies all waiting tasks that data is available
      *
-     * @note Thread-safe: triggers condition variable notification.
+     * @note Thread-safe: wakes waiters blocked in wait_until_retrievable().
      */
     auto set_data(const T& data) noexcept -> void
     {
         data_ = data;
+        pending_consumers_.store(consumer_count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        set_as_retrievable();
+    }
+
+    /**
+     * @brief Moves the data into the edge and marks it as retrievable.
+     * @param data Data to move into the edge.
+     *
+     * @note Thread-safe: wakes waiters blocked in wait_until_retrievable().
+     */
+    auto set_data(T&& data) noexcept -> void
+    {
+        data_ = std::move(data);
+        pending_consumers_.store(consumer_count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
         set_as_retrievable();
     }
 
+    /**
+     * @brief Marks the edge as retrievable with a failure instead of data.
+     * @param error Exception to keep in the edge if it has no owner; an owner node keeps its own.
+     *
+     * Consumers check has_failed(), then read get_exception().
+     *
+     * @note Thread-safe: wakes waiters blocked in wait_until_retrievable().
+     */
+    auto set_failed(std::exception_ptr error = nullptr) noexcept -> void
+    {
+        exception_ = std::move(error);
+        set_as_failed();
+    }
+
+    /**
+     * @brief Returns the exception of a failed edge.
+     * @return Exception of the owner node, or the one given to set_failed() if the edge has no owner.
+     *
+     * @note Only meaningful once has_failed() returned true.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr&
+    {
+        return get_owner() != nullptr ? get_owner()->get_exception() : exception_;
+    }
+
     /**
      * @brief Retrieves the data stored in the edge.
      * @return Copy of the stored data.
@@ -76,8 +137,107 @@ public:
         return data_;
     }
 
+    /**
+     * @brief Returns a const reference to the data stored in the edge.
+     * @return Reference valid until the edge is set again (or moved out by the last consumer).
+     *
+     * @note Does not block - caller must ensure data is ready.
+     */
+    auto get_data_ref() const noexcept -> const T&
+    {
+        return data_;
+    }
+
+    /**
+     * @brief Returns a read-only view over contiguous data (std::vector, std::array, ...).
+     * @return Span over the stored elements, with the same validity as get_data_ref().
+     *
+     * @note Does not block - caller must ensure data is ready.
+     */
+    auto get_data_span() const noexcept
+        requires std::ranges::contiguous_range<const T>
+    {
+        return std::span<const std::ranges::range_value_t<const T>>{std::ranges::data(data_),
+                                                                    std::ranges::size(data_)};
+    }
+
+    /**
+     * @brief Hands the data to a registered consumer.
+     * @return Copy of the data, or the data itself (moved out) in MoveToLastConsumer
+     *         mode when every other registered consumer has already taken its copy.
+     *
+     * Consumers that read concurrently all receive copies, so a move never races
+     * with a copy; the move is an optimization, never a requirement.
+     *
+     * @note Called once per run by each consumer registered with add_consumer().
+     */
+    auto take_data() const noexcept -> T
+    {
+        if (transfer_mode_ == EdgeTransferMode::MoveToLastConsumer &&
+            pending_consumers_.load(std::memory_order_acquire) == 1) {
+            pending_consumers_.store(0, std::memory_order_relaxed);
+            return std::move(data_);
+        }
+        T data = data_;
+        pending_consumers_.fetch_sub(1, std::memory_order_acq_rel);
+        return data;
+    }
+
+    /**
+     * @brief Sets how consumers receive the data.
+     * @param mode Transfer mode.
+     *
+     * @note Must be set before the producer runs.
+     */
+    auto set_transfer_mode(EdgeTransferMode mode) noexcept -> void
+    {
+        transfer_mode_ = mode;
+    }
+
+    /**
+     * @brief Returns how consumers receive the data.
+     * @return Transfer mode.
+     */
+    auto get_transfer_mode() const noexcept -> EdgeTransferMode
+    {
+        return transfer_mode_;
+    }
+
+    /**
+     * @brief Registers a consumer that will call take_data() once per run.
+     *
+     * Called by Node::add_inward_edge().
+     */
+    auto add_consumer() const noexcept -> void
+    {
+        consumer_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Unregisters a consumer.
+     *
+     * Called by Node::add_inward_edge() when an inward edge is replaced.
+     */
+    auto remove_consumer() const noexcept -> void
+    {
+        consumer_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of registered consumers.
+     * @return Consumer count.
+     */
+    auto get_consumer_count() const noexcept -> size_t
+    {
+        return consumer_count_.load(std::memory_order_relaxed);
+    }
+
 private:
-    T data_{};  ///< Data stored in the edge
+    mutable T data_{};                                          ///< Data stored in the edge
+    mutable std::atomic<size_t> consumer_count_{0};             ///< Registered consumers
+    mutable std::atomic<size_t> pending_consumers_{0};          ///< Consumers that have not taken the data yet
+    EdgeTransferMode transfer_mode_ = EdgeTransferMode::Copy;   ///< How consumers receive the data
+    std::exception_ptr exception_;                              ///< Failure of an edge without owner
 };
 
 /**
@@ -112,12 +272,38 @@ public:
      * This method signals task completion to dependent tasks.
      * Calls set_as_retrievable() to notify all waiting tasks.
      *
-     * @note Thread-safe: triggers condition variable notification.
+     * @note Thread-safe: wakes waiters blocked in wait_until_retrievable().
      */
     auto set_data() noexcept -> void
     {
         set_as_retrievable();
     }
+
+    /**
+     * @brief Marks the edge as retrievable with a failure.
+     * @param error Exception to keep in the edge if it has no owner; an owner node keeps its own.
+     *
+     * @note Thread-safe: wakes waiters blocked in wait_until_retrievable().
+     */
+    auto set_failed(std::exception_ptr error = nullptr) noexcept -> void
+    {
+        exception_ = std::move(error);
+        set_as_failed();
+    }
+
+    /**
+     * @brief Returns the exception of a failed edge.
+     * @return Exception of the owner node, or the one given to set_failed() if the edge has no owner.
+     *
+     * @note Only meaningful once has_failed() returned true.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr&
+    {
+        return get_owner() != nullptr ? get_owner()->get_exception() : exception_;
+    }
+
+private:
+    std::exception_ptr exception_; ///< Failure of an edge without owner
 };
 
 } // namespace tw
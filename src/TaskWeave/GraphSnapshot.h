@@ -0,0 +1,264 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include "IEdge.h"
+#include "INode.h"
+
+// STL
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tw {
+
+/**
+ * @brief Flat, contiguous snapshot of a task dependency graph.
+ *
+ * GraphSnapshot copies the structure reachable from a set of nodes (the nodes
+ * themselves plus every transitive predecessor) into dense arrays:
+ * - Each node gets a dense index in discovery order
+ * - Predecessors and successors are stored in CSR layout (one offsets array
+ *   plus one flat index array each)
+ *
+ * compute_levels() then runs Kahn's algorithm over the snapshot, computing
+ * every node's reachability in O(V + E) without recursion:
+ * - level = 0 for nodes without inputs (root nodes)
+ * - level = 1 + max(level of predecessors) otherwise (empty input slots count as 0)
+ *
+ * Discovery is an iterative depth-first walk using INode::get_inward_edge(), so
+ * neither deep chains (no recursion) nor per-visit std::vector allocations are a concern.
+ *
+ * Usage:
+ * @code
+ * std::vector<ITask*> tasks = {&task1, &task2, &task3};
+ * GraphSnapshot snapshot{tasks | std::views::transform([](ITask* t) { return t->as_node(); })};
+ * snapshot.compute_levels();
+ * snapshot.assign_reachability();
+ * @endcode
+ */
+class GraphSnapshot {
+public:
+    /**
+     * @brief Builds the snapshot of the nodes and all their transitive predecessors.
+     * @tparam NodeRange Range of INode pointers.
+     * @param nodes Starting nodes. Null pointers are ignored.
+     */
+    template<std::ranges::input_range NodeRange>
+    explicit GraphSnapshot(NodeRange&& nodes)
+    {
+        if constexpr (std::ranges::sized_range<NodeRange>) {
+            nodes_.reserve(std::ranges::size(nodes));
+            index_of_.reserve(std::ranges::size(nodes));
+        }
+        std::vector<uint32_t> stack;
+        for (INode* node : nodes) {
+            if (node && discover(node)) {
+                stack.push_back(static_cast<uint32_t>(nodes_.size() - 1));
+            }
+        }
+
+        // Iterative walk over inward edges; predecessors are recorded per node, in slot order
+        std::vector<std::pair<uint32_t, uint32_t>> links; // (consumer, producer)
+        while (!stack.empty()) {
+            const uint32_t current = stack.back();
+            stack.pop_back();
+            const INode* node = nodes_[current];
+            for (size_t slot = 0; slot < node->get_inward_edges_count(); slot++) {
+                const IEdge* edge = node->get_inward_edge(slot);
+                if (edge == nullptr || edge->get_owner() == nullptr) {
+                    continue;
+                }
+                INode* producer = edge->get_owner();
+                if (discover(producer)) {
+                    stack.push_back(static_cast<uint32_t>(nodes_.size() - 1));
+                }
+                links.emplace_back(current, index_of_[producer]);
+            }
+        }
+        build_csr(links);
+    }
+
+    /**
+     * @brief Computes the level (reachability) of every node with Kahn's algorithm.
+     * @return true if every node was levelled, false if the graph contains a cycle
+     *         (is_levelled() returns false for nodes on or after a cycle).
+     */
+    auto compute_levels() -> bool
+    {
+        const size_t node_count = nodes_.size();
+        levels_.assign(node_count, 0);
+        levelled_.assign(node_count, false);
+
+        std::vector<uint32_t> pending(node_count);
+        std::vector<uint32_t> queue;
+        queue.reserve(node_count);
+        for (size_t i = 0; i < node_count; i++) {
+            pending[i] = static_cast<uint32_t>(get_predecessors(i).size());
+            levels_[i] = nodes_[i]->get_inward_edges_count() > 0 ? 1 : 0;
+            if (pending[i] == 0) {
+                queue.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        for (size_t head = 0; head < queue.size(); head++) {
+            const uint32_t current = queue[head];
+            levelled_[current] = true;
+            for (const uint32_t successor : get_successors(current)) {
+                levels_[successor] = std::max(levels_[successor], levels_[current] + 1);
+                if (--pending[successor] == 0) {
+                    queue.push_back(successor);
+                }
+            }
+        }
+        return queue.size() == node_count;
+    }
+
+    /**
+     * @brief Writes the computed levels into the nodes (INode::assign_reachability).
+     *
+     * @note compute_levels() must have been called. Nodes that were not levelled are left untouched.
+     */
+    auto assign_reachability() const noexcept -> void
+    {
+        for (size_t i = 0; i < nodes_.size(); i++) {
+            if (levelled_[i]) {
+                nodes_[i]->assign_reachability(levels_[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of nodes in the snapshot (including discovered predecessors).
+     * @return Node count.
+     */
+    auto size() const noexcept -> size_t
+    {
+        return nodes_.size();
+    }
+
+    /**
+     * @brief Returns the node at a dense index.
+     * @param index Dense node index.
+     * @return Node pointer.
+     */
+    auto get_node(size_t index) const noexcept -> INode*
+    {
+        return nodes_[index];
+    }
+
+    /**
+     * @brief Returns the dense index of a node.
+     * @param node Node to look up.
+     * @return Index, or size() if the node is not part of the snapshot.
+     */
+    auto find(const INode* node) const noexcept -> size_t
+    {
+        auto it = index_of_.find(node);
+        return it != index_of_.end() ? it->second : nodes_.size();
+    }
+
+    /**
+     * @brief Returns the dense indices of a node's producers (one entry per connected edge).
+     * @param index Dense node index.
+     * @return Span of predecessor indices.
+     */
+    auto get_predecessors(size_t index) const noexcept -> std::span<const uint32_t>
+    {
+        return std::span<const uint32_t>{predecessors_}.subspan(
+            predecessor_offsets_[index], predecessor_offsets_[index + 1] - predecessor_offsets_[index]);
+    }
+
+    /**
+     * @brief Returns the dense indices of a node's consumers (one entry per connected edge).
+     * @param index Dense node index.
+     * @return Span of successor indices.
+     */
+    auto get_successors(size_t index) const noexcept -> std::span<const uint32_t>
+    {
+        return std::span<const uint32_t>{successors_}.subspan(
+            successor_offsets_[index], successor_offsets_[index + 1] - successor_offsets_[index]);
+    }
+
+    /**
+     * @brief Returns the level computed for a node.
+     * @param index Dense node index.
+     * @return Level (reachability), valid after compute_levels().
+     */
+    auto get_level(size_t index) const noexcept -> size_t
+    {
+        return levels_[index];
+    }
+
+    /**
+     * @brief Checks whether compute_levels() reached a node (false only for cyclic parts).
+     * @param index Dense node index.
+     * @return true if the node's level is valid.
+     */
+    auto is_levelled(size_t index) const noexcept -> bool
+    {
+        return levelled_[index];
+    }
+
+private:
+    /**
+     * @brief Assigns a dense index to a node seen for the first time.
+     * @param node Node to register.
+     * @return true if the node was new.
+     */
+    auto discover(INode* node) -> bool
+    {
+        auto [it, inserted] = index_of_.try_emplace(node, static_cast<uint32_t>(nodes_.size()));
+        if (inserted) {
+            nodes_.push_back(node);
+        }
+        return inserted;
+    }
+
+    /**
+     * @brief Builds predecessor and successor CSR arrays from (consumer, producer) links.
+     * @param links Links in discovery order.
+     */
+    auto build_csr(const std::vector<std::pair<uint32_t, uint32_t>>& links) -> void
+    {
+        const size_t node_count = nodes_.size();
+        predecessor_offsets_.assign(node_count + 1, 0);
+        successor_offsets_.assign(node_count + 1, 0);
+        for (const auto& [consumer, producer] : links) {
+            predecessor_offsets_[consumer + 1]++;
+            successor_offsets_[producer + 1]++;
+        }
+        for (size_t i = 0; i < node_count; i++) {
+            predecessor_offsets_[i + 1] += predecessor_offsets_[i];
+            successor_offsets_[i + 1] += successor_offsets_[i];
+        }
+
+        predecessors_.resize(links.size());
+        successors_.resize(links.size());
+        std::vector<size_t> predecessor_cursor(predecessor_offsets_.begin(), predecessor_offsets_.end() - 1);
+        std::vector<size_t> successor_cursor(successor_offsets_.begin(), successor_offsets_.end() - 1);
+        for (const auto& [consumer, producer] : links) {
+            predecessors_[predecessor_cursor[consumer]++] = producer;
+            successors_[successor_cursor[producer]++] = consumer;
+        }
+    }
+
+private:
+    std::vector<INode*> nodes_;                          ///< Nodes by dense index
+    std::unordered_map<const INode*, uint32_t> index_of_; ///< Node to dense index
+    std::vector<size_t> predecessor_offsets_;            ///< predecessors_ range of node i: [offsets[i], offsets[i + 1])
+    std::vector<uint32_t> predecessors_;                 ///< Flattened predecessor indices
+    std::vector<size_t> successor_offsets_;              ///< successors_ range of node i: [offsets[i], offsets[i + 1])
+    std::vector<uint32_t> successors_;                   ///< Flattened successor indices
+    std::vector<size_t> levels_;                         ///< Level per node (after compute_levels)
+    std::vector<bool> levelled_;                         ///< Dense bitmap of nodes reached by compute_levels
+};
+
+} // namespace tw
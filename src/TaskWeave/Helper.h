@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include "GraphSnapshot.h"
 #include "INode.h"
 
+// STL
+#include <vector>
+
 namespace tw {
 
 /**
@@ -16,9 +20,12 @@ namespace tw {
  * to any of its dependency in the dependency graph.
  *
  * Algorithm:
- * 1. Creates a shared traverse marker to track visited nodes
- * 2. For each task in the range, calls set_reachability() with the marker
- * 3. The marker ensures shared dependencies are not counted multiple times
+ * 1. Builds a GraphSnapshot (flat CSR copy) of the tasks and their transitive predecessors
+ * 2. Computes levels with an iterative Kahn pass in O(V + E)
+ * 3. Writes the levels back with INode::assign_reachability()
+ *
+ * Unlike INode::set_reachability(), this does not recurse, so arbitrarily deep
+ * chains are safe. Nodes on a cycle keep their previous reachability.
  *
  * @tparam TaskRange A range type containing pointers to tasks (Task*, ITask*, etc.)
  * @param tasks A range of task pointers
@@ -35,12 +42,15 @@ namespace tw {
 template<typename TaskRange>
 auto compute_reachability(TaskRange&& tasks) noexcept -> void
 {
-    INode::TraverseMarkerT marker;
+    std::vector<INode*> nodes;
     for (auto* task : tasks) {
         if (task) {
-            task->as_node()->set_reachability(marker);
+            nodes.emplace_back(task->as_node());
         }
     }
+    GraphSnapshot snapshot{nodes};
+    snapshot.compute_levels();
+    snapshot.assign_reachability();
 }
 
 } // namespace tw
@@ -6,14 +6,25 @@
 
 // STL
 #include <atomic>
-#include <condition_variable>
 #include <cstddef>
-#include <string>
+#include <cstdint>
+#include <stop_token>
 
 namespace tw {
 
 class INode;
 
+/**
+ * @brief Intrusive record of a waiter that must not block, e.g. a suspended coroutine.
+ *
+ * Registered with IEdge::add_waiter(); the producer calls on_ready once the edge
+ * becomes retrievable. The record must stay alive until on_ready has been called.
+ */
+struct EdgeWaiter {
+    EdgeWaiter* next = nullptr;              ///< Next waiter registered on the same edge
+    void (*on_ready)(EdgeWaiter*) = nullptr; ///< Called by the producing thread after the data is set
+};
+
 /**
  * @brief Base class representing an edge in the task dependency graph.
  *
@@ -22,9 +33,16 @@ class INode;
  * ensure data is available before dependent tasks access it.
  *
  * Thread Safety:
- * - Uses atomic flag for retrievable state
- * - Condition variable for blocking until data is ready
- * - Mutex protects state transitions
+ * - One atomic state word holds the retrievable and failed flags and a wake epoch
+ * - Blocking waits use C++20 atomic wait/notify (futex-style) on that word; a stop
+ *   request bumps the epoch so a stop-aware wait cannot miss its wakeup
+ * - A waiter count lets set_as_retrievable() skip the notify when nobody waits
+ * - Non-blocking waiters (EdgeWaiter) sit in a lock-free intrusive list that the
+ *   producer detaches in one exchange; a sentinel head marks the edge as set
+ *
+ * Failure:
+ * - A producer that failed marks the edge retrievable with a failure flag instead
+ *   of data; the exception itself is kept by the owner (INode::get_exception())
  */
 class IEdge {
 public:
@@ -46,7 +64,18 @@ public:
      */
     auto is_retrievable() const noexcept -> bool
     {
-        return is_retrievable_.load(std::memory_order_acquire);
+        return (state_.load(std::memory_order_acquire) & kRetrievable) != 0;
+    }
+
+    /**
+     * @brief Checks if the producer failed instead of setting the data.
+     * @return true if the edge is retrievable without valid data.
+     *
+     * @note Only meaningful once is_retrievable() returned true (or a wait returned).
+     */
+    auto has_failed() const noexcept -> bool
+    {
+        return (state_.load(std::memory_order_acquire) & kFailed) != 0;
     }
 
     /**
@@ -61,17 +90,89 @@ public:
     /**
      * @brief Blocks until the edge data becomes retrievable.
      *
-     * Waits on condition variable until is_retrievable() returns true.
+     * Returns immediately if the data is already retrievable, otherwise sleeps
+     * on the retrievable flag until set_as_retrievable() is called.
      * Used by dependent tasks to synchronize data access.
      *
-     * @note Thread-safe: uses mutex and condition variable.
+     * @note Thread-safe: uses atomic wait.
      */
     auto wait_until_retrievable() const noexcept -> void
     {
-        std::unique_lock lk{mtx_};
-        cv_.wait(lk, [this]() {
-            return is_retrievable_.load(std::memory_order_acquire);
+        if (is_retrievable()) {
+            return;
+        }
+        // Register before re-checking, so the producer either sees the waiter or we see the flag
+        waiter_count_.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t state = state_.load(std::memory_order_seq_cst);
+        while ((state & kRetrievable) == 0) {
+            state_.wait(state, std::memory_order_acquire);
+            state = state_.load(std::memory_order_seq_cst);
+        }
+        waiter_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Blocks until the edge data becomes retrievable or a stop is requested.
+     * @param stop_token Token whose stop request ends the wait early.
+     * @return true if the data is retrievable, false if the wait was stopped first.
+     *
+     * @note Thread-safe: uses atomic wait; a stop callback wakes the waiter.
+     */
+    auto wait_until_retrievable(const std::stop_token& stop_token) const noexcept -> bool
+    {
+        if (is_retrievable()) {
+            return true;
+        }
+        if (!stop_token.stop_possible()) {
+            wait_until_retrievable();
+            return true;
+        }
+        waiter_count_.fetch_add(1, std::memory_order_seq_cst);
+        const std::stop_callback wake(stop_token, [this]() noexcept {
+            // Change the word so a waiter about to sleep on the old value returns at once
+            state_.fetch_add(kWakeEpoch, std::memory_order_seq_cst);
+            state_.notify_all();
         });
+        uint32_t state = state_.load(std::memory_order_seq_cst);
+        while ((state & kRetrievable) == 0 && !stop_token.stop_requested()) {
+            state_.wait(state, std::memory_order_acquire);
+            state = state_.load(std::memory_order_seq_cst);
+        }
+        waiter_count_.fetch_sub(1, std::memory_order_relaxed);
+        return (state & kRetrievable) != 0;
+    }
+
+    /**
+     * @brief Registers a waiter to be called back once the edge becomes retrievable.
+     * @param waiter Waiter record; must stay alive until its on_ready callback runs.
+     * @return true if the waiter was registered, false if the data is already
+     *         retrievable (the waiter is not registered and will not be called).
+     *
+     * @note Thread-safe: lock-free push onto the waiter list.
+     */
+    auto add_waiter(EdgeWaiter* waiter) const noexcept -> bool
+    {
+        EdgeWaiter* head = waiters_.load(std::memory_order_acquire);
+        do {
+            if (head == ready_sentinel()) {
+                return false;
+            }
+            waiter->next = head;
+        } while (!waiters_.compare_exchange_weak(head, waiter, std::memory_order_acq_rel, std::memory_order_acquire));
+        return true;
+    }
+
+    /**
+     * @brief Marks the edge data as no longer retrievable.
+     *
+     * Used when a graph is re-run: the producing task sets the data again.
+     *
+     * @note Must not be called while the producer or consumers of the edge are running.
+     */
+    auto reset() noexcept -> void
+    {
+        state_.store(0, std::memory_order_release);
+        waiters_.store(nullptr, std::memory_order_release);
     }
 
 protected:
@@ -79,25 +180,66 @@ protected:
      * @brief Marks the edge data as retrievable and notifies waiters.
      *
      * Called by the producing task after writing data to the edge.
-     * Wakes up all tasks waiting for this edge's data.
+     * Wakes up all tasks waiting for this edge's data; the notify is skipped
+     * when no task is waiting. Registered EdgeWaiters are called back on this thread.
      *
-     * @note Thread-safe: uses mutex and condition variable.
+     * @note Thread-safe: lock-free unless there are waiters.
      */
     auto set_as_retrievable() noexcept -> void
     {
-        {
-            std::unique_lock lk{mtx_};
-            is_retrievable_.store(true, std::memory_order_release);
+        publish(kRetrievable);
+    }
+
+    /**
+     * @brief Marks the edge as retrievable with a failure instead of data, and notifies waiters.
+     *
+     * Waiters wake up as with set_as_retrievable() and see has_failed() == true.
+     */
+    auto set_as_failed() noexcept -> void
+    {
+        publish(kRetrievable | kFailed);
+    }
+
+private:
+    /**
+     * @brief Sets state flags, wakes blocked waiters and calls back registered EdgeWaiters.
+     * @param flags Flags to set (kRetrievable, plus kFailed for a failure).
+     */
+    auto publish(uint32_t flags) noexcept -> void
+    {
+        state_.fetch_or(flags, std::memory_order_seq_cst);
+        if (waiter_count_.load(std::memory_order_seq_cst) > 0) {
+            state_.notify_all();
+        }
+        EdgeWaiter* waiter = waiters_.exchange(ready_sentinel(), std::memory_order_acq_rel);
+        // The list is already detached if the data is set twice without a reset
+        while (waiter != nullptr && waiter != ready_sentinel()) {
+            // Read next first: on_ready may end the waiter's lifetime
+            EdgeWaiter* next = waiter->next;
+            waiter->on_ready(waiter);
+            waiter = next;
         }
-        cv_.notify_all();
+    }
+
+    /**
+     * @brief Returns the list head marking an edge whose data is already set.
+     * @return Address of a static waiter that is never called.
+     */
+    static auto ready_sentinel() noexcept -> EdgeWaiter*
+    {
+        static EdgeWaiter sentinel;
+        return &sentinel;
     }
 
 private:
-    INode* owner_;                              ///< Owner node of this edge
-    std::string owner_name_{};                  ///< Owner node name (unused)
-    mutable std::condition_variable cv_;        ///< Notifies when data is ready
-    mutable std::mutex mtx_;                    ///< Protects retrievable state
-    std::atomic<bool> is_retrievable_{};        ///< Flag indicating data availability
+    static constexpr uint32_t kRetrievable = 1U; ///< State bit: data (or a failure) is set
+    static constexpr uint32_t kFailed = 2U;      ///< State bit: the producer failed, no data
+    static constexpr uint32_t kWakeEpoch = 4U;   ///< State increment waking stop-aware waiters
+
+    INode* owner_;                                 ///< Owner node of this edge
+    mutable std::atomic<uint32_t> state_{};        ///< Flags and wake epoch (also the wait address)
+    mutable std::atomic<uint32_t> waiter_count_{}; ///< Threads blocked in wait_until_retrievable()
+    mutable std::atomic<EdgeWaiter*> waiters_{};   ///< Non-blocking waiters, or ready_sentinel() once set
 };
 
 } // namespace tw
@@ -5,6 +5,8 @@
 #pragma once
 
 // STL
+#include <cstddef>
+#include <exception>
 #include <set>
 #include <vector>
 
@@ -49,12 +51,27 @@ public:
      */
     virtual auto get_inward_edges() const noexcept -> std::vector<const IEdge*> = 0;
 
+    /**
+     * @brief Returns one inward edge without allocating.
+     * @param index Position of the edge, less than get_inward_edges_count().
+     * @return Pointer to the edge, or nullptr if the slot is empty or index is out of range.
+     */
+    virtual auto get_inward_edge(size_t index) const noexcept -> const IEdge* = 0;
+
     /**
      * @brief Returns the count of inward edges.
      * @return Number of dependencies this task has.
      */
     virtual auto get_inward_edges_count() const noexcept -> size_t = 0;
 
+    /**
+     * @brief Returns the failure carried by this node's outward edge.
+     * @return Exception that failed the node, or nullptr.
+     *
+     * Consumers read it after IEdge::has_failed() returned true on the outward edge.
+     */
+    virtual auto get_exception() const noexcept -> const std::exception_ptr& = 0;
+
     /**
      * @brief Comparison operator for topological sorting.
      * @param other Node to compare with.
@@ -97,6 +114,15 @@ public:
      * @note The marker is modified during traversal.
      */
     virtual auto set_reachability(TraverseMarkerT& traverse_marker) noexcept -> void = 0;
+
+    /**
+     * @brief Stores a reachability computed externally.
+     * @param reachability Reachability value to store.
+     *
+     * Used by GraphSnapshot, which computes every node's reachability in one
+     * iterative pass. Root nodes always report 0 and ignore the value.
+     */
+    virtual auto assign_reachability(size_t reachability) noexcept -> void = 0;
 };
 
 } // namespace tw
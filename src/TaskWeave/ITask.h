@@ -4,17 +4,24 @@
 
 #pragma once
 
+#include "IEdge.h"
+#include "INode.h"
+#include "ThisTask.h"
+#include "Watchdog.h"
+
 // STL
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <exception>
+#include <optional>
+#include <stop_token>
 #include <string>
 #include <string_view>
 
 namespace tw {
 
-class INode;
-
 /**
  * @brief Enumeration of task execution states.
  *
@@ -24,15 +31,74 @@ enum class TaskState : uint32_t {
     Incomplete,  ///< Task has not started execution
     Running,     ///< Task is currently executing
     Complete,    ///< Task has finished execution
+    Failed,      ///< Task (or a task it depends on) threw; the callable's result is not available
+    Cancelled,   ///< Task was cancelled before it started (or depends on a cancelled task)
     Size_        ///< Count of states (for bounds checking)
 };
 
+/**
+ * @brief Exception stored by a task that was cancelled instead of run.
+ *
+ * Dependents of a cancelled task see this exception on their inward edge and
+ * become Cancelled too.
+ */
+class TaskCancelled : public std::exception {
+public:
+    auto what() const noexcept -> const char* override
+    {
+        return "task cancelled";
+    }
+};
+
+/**
+ * @brief Exception stored by a task dropped because its (or its run's) deadline passed.
+ */
+class DeadlineExceeded : public TaskCancelled {
+public:
+    auto what() const noexcept -> const char* override
+    {
+        return "task deadline exceeded";
+    }
+};
+
+/**
+ * @brief Returns the shared exception_ptr holding TaskCancelled.
+ * @return The same pointer on every call, so cancellation is recognized by comparison.
+ */
+inline auto task_cancelled_exception() -> const std::exception_ptr&
+{
+    static const std::exception_ptr cancelled = std::make_exception_ptr(TaskCancelled{});
+    return cancelled;
+}
+
+/**
+ * @brief Returns the shared exception_ptr holding DeadlineExceeded.
+ * @return The same pointer on every call.
+ */
+inline auto deadline_exceeded_exception() -> const std::exception_ptr&
+{
+    static const std::exception_ptr exceeded = std::make_exception_ptr(DeadlineExceeded{});
+    return exceeded;
+}
+
+/**
+ * @brief Checks whether a task failure is a cancellation rather than an error.
+ * @param error Exception of a finished task.
+ * @return true for task_cancelled_exception() and deadline_exceeded_exception().
+ */
+inline auto is_cancellation(const std::exception_ptr& error) noexcept -> bool
+{
+    return error == task_cancelled_exception() || error == deadline_exceeded_exception();
+}
+
 /**
  * @brief Interface class representing a task.
  *
  * ITask defines the interface for all task implementations. It provides:
  * - Task identification (name, description)
- * - Execution state tracking (Incomplete, Running, Complete)
+ * - Execution state tracking (Incomplete, Running, Complete, Failed, Cancelled)
+ * - Failure reporting: an exception thrown by the callable is captured, not rethrown
+ * - Cancellation: the run's stop token (this_task) and an optional start deadline
  * - Timing information (start time, end time, duration)
  * - Dependency graph integration (via INode)
  * - Execution control (run, wait)
@@ -71,7 +137,7 @@ public:
 
     /**
      * @brief Returns the current execution state.
-     * @return Current TaskState (Incomplete, Running, or Complete).
+     * @return Current TaskState (Incomplete, Running, Complete, Failed or Cancelled).
      *
      * @note Lock-free: uses atomic load with relaxed semantics.
      */
@@ -80,6 +146,103 @@ public:
         return state_.load(std::memory_order_relaxed);
     }
 
+    /**
+     * @brief Checks whether the task has finished, successfully or not.
+     * @return true if the state is Complete, Failed or Cancelled.
+     */
+    auto is_finished() const noexcept -> bool
+    {
+        const TaskState state = get_state();
+        return state == TaskState::Complete || state == TaskState::Failed || state == TaskState::Cancelled;
+    }
+
+    /**
+     * @brief Returns the exception that made the task fail.
+     * @return The exception thrown by this task's callable or by a task it depends on
+     *         (TaskCancelled if cancelled), or nullptr.
+     *
+     * @note Valid once wait() has returned.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr&
+    {
+        return as_node()->get_exception();
+    }
+
+    /**
+     * @brief Rethrows the exception that made the task fail, if any.
+     *
+     * @note Valid once wait() has returned.
+     */
+    auto rethrow_if_failed() const -> void
+    {
+        if (const auto& error = get_exception()) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief Sets the time by which the task must have started.
+     * @param deadline Deadline; time_point::max() (the default) disables it.
+     *
+     * A task that has not started by its deadline, including one still waiting for
+     * its inputs, is dropped: it ends Cancelled with DeadlineExceeded and releases
+     * its dependents. The deadline is absolute; set it again before re-running.
+     */
+    auto set_deadline(std::chrono::steady_clock::time_point deadline) noexcept -> void
+    {
+        deadline_ = deadline;
+    }
+
+    /**
+     * @brief Returns the time by which the task must have started.
+     * @return Deadline, or time_point::max() if there is none.
+     */
+    auto get_deadline() const noexcept -> std::chrono::steady_clock::time_point
+    {
+        return deadline_;
+    }
+
+    /**
+     * @brief Sets the NUMA node the task should run on.
+     * @param node Node id, or std::nullopt (the default) to run anywhere.
+     *
+     * A hint for NUMA-aware pools (NumaThreadPool): the executor queues the task
+     * on that node, so it runs next to the memory of its inputs. Give a producer
+     * and its consumers the same node to keep their edge data on one socket.
+     * Other pools ignore it.
+     */
+    auto set_numa_node(std::optional<uint32_t> node) noexcept -> void
+    {
+        numa_node_ = node;
+    }
+
+    /**
+     * @brief Returns the NUMA node the task should run on.
+     * @return Node id, or std::nullopt if the task may run anywhere.
+     */
+    auto get_numa_node() const noexcept -> std::optional<uint32_t>
+    {
+        return numa_node_;
+    }
+
+    /**
+     * @brief Returns the time the callable last started.
+     * @return Start time of the last run that reached the callable.
+     */
+    auto get_start_time() const noexcept -> std::chrono::steady_clock::time_point
+    {
+        return start_time_;
+    }
+
+    /**
+     * @brief Returns the time the callable last returned or threw.
+     * @return End time of the last run that reached the callable.
+     */
+    auto get_end_time() const noexcept -> std::chrono::steady_clock::time_point
+    {
+        return end_time_;
+    }
+
     /**
      * @brief Returns the task execution duration.
      * @tparam DurationRepT Duration type to cast the result to.
@@ -104,15 +267,40 @@ public:
      * 5. Set output data to outward edges
      * 6. Record end time and set state to Complete
      *
+     * If an inward edge carries a failure, the callable is skipped and the failure
+     * is forwarded. If the callable throws, the exception is stored and forwarded
+     * to the outward edge (state Failed); run() itself does not throw.
+     *
      * @note Should be called by the Executor worker.
      */
     virtual void run() = 0;
 
+    /**
+     * @brief Finishes the task without running it.
+     *
+     * Sets the state to Cancelled and fails the outward edge with TaskCancelled,
+     * so dependents (even ones already waiting on it) skip execution as well.
+     *
+     * @note Must not be called while the task is running.
+     */
+    virtual void cancel() = 0;
+
+    /**
+     * @brief Returns the task to its initial state so it can run again.
+     *
+     * Implementations should set the state back to Incomplete and mark the
+     * outward edge as not retrievable. The previous result is kept until the
+     * next run overwrites it.
+     *
+     * @note Must not be called while the task or its consumers are running.
+     */
+    virtual void reset() = 0;
+
     /**
      * @brief Waits for the task to complete execution.
      * @return TaskState after completion.
      *
-     * Blocks until the task reaches Complete state.
+     * Blocks until the task reaches Complete, Failed or Cancelled state.
      *
      * @note Implementation should use condition variable or spin-wait.
      */
@@ -143,6 +331,50 @@ public:
     virtual auto as_node() const noexcept -> const INode* = 0;
 
 protected:
+    /**
+     * @brief Waits for one inward edge, giving up on a stop request or the task deadline.
+     * @param edge Inward edge.
+     * @param context Context of the current run.
+     * @return true if the edge is retrievable, false if the wait was stopped.
+     */
+    auto wait_for_input(const IEdge& edge, const detail::TaskContext& context) const -> bool
+    {
+        if (edge.is_retrievable()) {
+            return true;
+        }
+        // Lets an elastic pool start another worker while this one sleeps
+        const BlockingRegion blocking;
+        if (deadline_ == std::chrono::steady_clock::time_point::max()) {
+            return edge.wait_until_retrievable(context.stop_token);
+        }
+        // The task deadline stops a local source, which the run's token also stops
+        std::stop_source expiry;
+        const std::stop_callback forward(context.stop_token, [&expiry]() noexcept {
+            expiry.request_stop();
+        });
+        const Watchdog::Timer timer(deadline_, expiry);
+        return edge.wait_until_retrievable(expiry.get_token());
+    }
+
+    /**
+     * @brief Checks whether the task must be dropped instead of started.
+     * @param context Context of the current run.
+     * @return deadline_exceeded_exception() past the task or run deadline,
+     *         task_cancelled_exception() if the run was stopped, else nullptr.
+     */
+    auto get_stop_reason(const detail::TaskContext& context) const noexcept -> std::exception_ptr
+    {
+        const auto deadline = std::min(deadline_, context.deadline);
+        if (deadline != std::chrono::steady_clock::time_point::max() &&
+            std::chrono::steady_clock::now() >= deadline) {
+            return deadline_exceeded_exception();
+        }
+        if (context.stop_token.stop_requested()) {
+            return task_cancelled_exception();
+        }
+        return nullptr;
+    }
+
     /**
      * @brief Sets the task start time.
      * @param start_time Time point when task execution began.
@@ -195,6 +427,8 @@ private:
     std::string desc_;                                    ///< Task description
     std::chrono::steady_clock::time_point start_time_;    ///< Task start time
     std::chrono::steady_clock::time_point end_time_;      ///< Task end time
+    std::chrono::steady_clock::time_point deadline_ = std::chrono::steady_clock::time_point::max(); ///< Start deadline
+    std::optional<uint32_t> numa_node_;                   ///< NUMA node hint (nullopt = anywhere)
     std::atomic<TaskState> state_;                        ///< Current execution state
 };
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "UniqueFunction.h"
+
 // STL
 #include <cstddef>
 #include <functional>
@@ -185,6 +187,14 @@ struct function_from_tuple<RT, std::tuple<Args...>> {
     using type = typename std::function<RT(Args...)>;
 };
 
+template<typename RT, typename TupleT>
+struct unique_function_from_tuple;
+
+template<typename RT, typename... Args>
+struct unique_function_from_tuple<RT, std::tuple<Args...>> {
+    using type = UniqueFunction<RT(Args...)>;
+};
+
 template<typename... Ts>
 struct integer_sequence_void_filter {
     template<size_t... Idxs>
@@ -216,6 +226,15 @@ struct is_std_function<std::function<R(ArgsT...)>> : std::true_type {};
 template<typename FnT>
 bool constexpr is_std_function_v = is_std_function<FnT>::value;
 
+template<typename FnT>
+struct is_unique_function : std::false_type {};
+
+template<typename Signature, size_t InlineSize>
+struct is_unique_function<UniqueFunction<Signature, InlineSize>> : std::true_type {};
+
+template<typename FnT>
+bool constexpr is_unique_function_v = is_unique_function<FnT>::value;
+
 /**
  * @brief Compile-time check that a tuple contains no duplicate types.
  *
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -75,8 +76,7 @@ public:
     auto add_inward_edge(const Edge<InputT>* edge) noexcept -> void
     {
         if constexpr ((std::is_same_v<InputT, InwardTs> || ...)) {
-            auto& in_edge = std::get<const Edge<InputT>*>(in_edges_);
-            in_edge = edge;
+            replace_inward_edge(std::get<const Edge<InputT>*>(in_edges_), edge);
         }
         else {
             // Fail the compilation here
@@ -101,8 +101,7 @@ public:
         if constexpr (
             (std::is_same_v<InputT, InwardTs> || ...) &&
             std::is_same_v<std::tuple_element_t<Idx, decltype(in_edges_)>, const Edge<InputT>*>) {
-            auto& in_edge = std::get<Idx>(in_edges_);
-            in_edge = edge;
+            replace_inward_edge(std::get<Idx>(in_edges_), edge);
         }
         else {
             // Fail the compilation here
@@ -113,9 +112,10 @@ public:
     /**
      * @brief Retrieves data from an inward edge by type.
      * @tparam InputT The type of data to retrieve.
-     * @return Copy of the data, or default-constructed value if edge is null.
+     * @return The data (copied, or moved out if this node is the edge's last consumer
+     *         in EdgeTransferMode::MoveToLastConsumer), or default-constructed value if edge is null.
      *
-     * Waits for the edge to be retrievable before accessing data.
+     * Caller must ensure the edge is retrievable.
      * Requires no duplicate types for unambiguous matching.
      */
     template<typename InputT>
@@ -124,7 +124,7 @@ public:
     {
         auto edge = std::get<const Edge<InputT>*>(in_edges_);
         if (edge) {
-            return edge->get_data();
+            return edge->take_data();
         }
         else {
             return InputT();
@@ -134,16 +134,17 @@ public:
     /**
      * @brief Retrieves data from an inward edge by index.
      * @tparam Idx The index of the edge in the tuple.
-     * @return Copy of the data, or default-constructed value if edge is null.
+     * @return The data (copied, or moved out if this node is the edge's last consumer
+     *         in EdgeTransferMode::MoveToLastConsumer), or default-constructed value if edge is null.
      *
-     * Waits for the edge to be retrievable before accessing data.
+     * Caller must ensure the edge is retrievable.
      */
     template<size_t Idx>
     auto get_inward_edge_value() const noexcept -> std::tuple_element_t<Idx, std::tuple<InwardTs...>>
     {
         auto edge = std::get<Idx>(in_edges_);
         if (edge) {
-            return edge->get_data();
+            return edge->take_data();
         }
         else {
             return std::tuple_element_t<Idx, std::tuple<InwardTs...>>();
@@ -161,6 +162,18 @@ public:
         return &out_edge_;
     }
 
+    /**
+     * @brief Sets how consumers receive this node's output.
+     * @param mode Transfer mode of the outward edge.
+     *
+     * @note Must be set before the node's task runs.
+     */
+    auto set_out_edge_transfer_mode(EdgeTransferMode mode) noexcept -> void
+        requires(!std::is_same_v<OutwardT, void>)
+    {
+        out_edge_.set_transfer_mode(mode);
+    }
+
     /**
      * @brief Returns all inward edges as a vector.
      * @return Vector of const IEdge pointers.
@@ -175,6 +188,37 @@ public:
         }(std::make_index_sequence<std::tuple_size_v<decltype(in_edges_)>>{});
     }
 
+    /**
+     * @brief Returns one inward edge without allocating.
+     * @param index Position of the edge in the tuple.
+     * @return Pointer to the edge, or nullptr if unset or out of range.
+     */
+    auto get_inward_edge(size_t index) const noexcept -> const IEdge* override
+    {
+        const IEdge* edge = nullptr;
+        [&]<size_t... Idxs>(std::index_sequence<Idxs...>) {
+            ((Idxs == index ? (edge = std::get<Idxs>(in_edges_), true) : false) || ...);
+        }(std::make_index_sequence<inward_edges_type_count>{});
+        return edge;
+    }
+
+    /**
+     * @brief Returns the exception of a failed inward edge.
+     * @param index Position of the edge in the tuple.
+     * @return Exception of the producer (see Edge::get_exception()), or nullptr if unset or out of range.
+     */
+    auto get_inward_exception(size_t index) const noexcept -> std::exception_ptr
+    {
+        std::exception_ptr error;
+        [&]<size_t... Idxs>(std::index_sequence<Idxs...>) {
+            ((Idxs == index && std::get<Idxs>(in_edges_) != nullptr
+                  ? (error = std::get<Idxs>(in_edges_)->get_exception(), true)
+                  : false)
+             || ...);
+        }(std::make_index_sequence<inward_edges_type_count>{});
+        return error;
+    }
+
     /**
      * @brief Returns the count of inward edges.
      * @return Number of input dependencies.
@@ -257,6 +301,24 @@ public:
         reachability_ = *std::max_element(inward_reachabilities.begin(), inward_reachabilities.end()) + 1;
     }
 
+    /**
+     * @brief Stores a reachability computed externally (e.g. by GraphSnapshot).
+     * @param reachability Reachability value to store.
+     */
+    auto assign_reachability(size_t reachability) noexcept -> void override
+    {
+        reachability_ = reachability;
+    }
+
+    /**
+     * @brief Returns the failure carried by the outward edge.
+     * @return Exception set by set_out_edge_failed(), or nullptr.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr& override
+    {
+        return error_;
+    }
+
     /**
      * @brief Comparison operator for topological sorting.
      * @param other Node to compare with.
@@ -282,24 +344,68 @@ protected:
         out_edge_.set_data();
     }
 
+    /**
+     * @brief Marks the outward edge as not retrievable.
+     *
+     * Called when the task is reset for another run.
+     */
+    auto reset_out_edge() noexcept -> void
+    {
+        error_ = nullptr;
+        out_edge_.reset();
+    }
+
+    /**
+     * @brief Stores a failure and marks the outward edge as failed.
+     * @param error Exception reported by get_exception().
+     *
+     * Called instead of set_out_edge_data() when the task did not produce a result.
+     */
+    auto set_out_edge_failed(std::exception_ptr error) noexcept -> void
+    {
+        error_ = std::move(error);
+        out_edge_.set_failed();
+    }
+
     /**
      * @brief Sets the outward edge data for non-void output type.
      * @tparam U Output type (deduced from argument).
-     * @param data Data to store in the outward edge.
+     * @param data Data to copy or move into the outward edge.
      *
      * Stores the task result in the outward edge and marks it retrievable.
      * Called after task execution completes.
      */
     template<typename U = OutwardT>
-    auto set_out_edge_data(const U& data) noexcept -> void
-        requires(!std::is_same_v<U, void>)
+    auto set_out_edge_data(U&& data) noexcept -> void
+        requires(!std::is_same_v<std::remove_cvref_t<U>, void>)
     {
-        out_edge_.set_data(data);
+        out_edge_.set_data(std::forward<U>(data));
+    }
+
+private:
+    /**
+     * @brief Stores an inward edge, moving the consumer registration from the previous edge.
+     * @param slot Inward edge slot to update.
+     * @param edge New edge (may be null).
+     */
+    template<typename InputT>
+    static auto replace_inward_edge(const Edge<InputT>*& slot, const Edge<InputT>* edge) noexcept -> void
+    {
+        if constexpr (!std::is_void_v<InputT>) {
+            if (slot) {
+                slot->remove_consumer();
+            }
+            if (edge) {
+                edge->add_consumer();
+            }
+        }
+        slot = edge;
     }
 
 private:
     InwardEdgesTupleType in_edges_{}; ///< Tuple of inward edge pointers
     Edge<OutwardT> out_edge_;         ///< Outward edge owned by this node
+    std::exception_ptr error_;        ///< Failure forwarded through out_edge_
     size_t reachability_{};           ///< Computed reachability value
 };
 
@@ -346,6 +452,36 @@ public:
         return &out_edge_;
     }
 
+    /**
+     * @brief Sets how consumers receive this node's output.
+     * @param mode Transfer mode of the outward edge.
+     *
+     * @note Must be set before the node's task runs.
+     */
+    auto set_out_edge_transfer_mode(EdgeTransferMode mode) noexcept -> void
+        requires(!std::is_same_v<OutwardT, void>)
+    {
+        out_edge_.set_transfer_mode(mode);
+    }
+
+    /**
+     * @brief Returns nullptr (no dependencies).
+     * @return nullptr
+     */
+    auto get_inward_edge(size_t) const noexcept -> const IEdge* override
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns nullptr (no dependencies).
+     * @return nullptr
+     */
+    auto get_inward_exception(size_t) const noexcept -> std::exception_ptr
+    {
+        return nullptr;
+    }
+
     /**
      * @brief Returns zero (no dependencies).
      * @return 0
@@ -385,6 +521,22 @@ public:
         traverse_marker.emplace(reinterpret_cast<size_t>(this));
     }
 
+    /**
+     * @brief No-op for root nodes (reachability is always 0).
+     */
+    auto assign_reachability(size_t) noexcept -> void override
+    {
+    }
+
+    /**
+     * @brief Returns the failure carried by the outward edge.
+     * @return Exception set by set_out_edge_failed(), or nullptr.
+     */
+    auto get_exception() const noexcept -> const std::exception_ptr& override
+    {
+        return error_;
+    }
+
     /**
      * @brief Comparison operator for topological sorting.
      * @param other Node to compare with.
@@ -407,20 +559,44 @@ protected:
         out_edge_.set_data();
     }
 
+    /**
+     * @brief Marks the outward edge as not retrievable.
+     *
+     * Called when the task is reset for another run.
+     */
+    auto reset_out_edge() noexcept -> void
+    {
+        error_ = nullptr;
+        out_edge_.reset();
+    }
+
+    /**
+     * @brief Stores a failure and marks the outward edge as failed.
+     * @param error Exception reported by get_exception().
+     *
+     * Called instead of set_out_edge_data() when the task did not produce a result.
+     */
+    auto set_out_edge_failed(std::exception_ptr error) noexcept -> void
+    {
+        error_ = std::move(error);
+        out_edge_.set_failed();
+    }
+
     /**
      * @brief Sets the outward edge data for non-void output type.
      * @tparam U Output type (deduced from argument).
-     * @param data Data to store in the outward edge.
+     * @param data Data to copy or move into the outward edge.
      */
     template<typename U = OutwardT>
-    auto set_out_edge_data(const U& data) noexcept -> void
-        requires(!std::is_same_v<U, void>)
+    auto set_out_edge_data(U&& data) noexcept -> void
+        requires(!std::is_same_v<std::remove_cvref_t<U>, void>)
     {
-        out_edge_.set_data(data);
+        out_edge_.set_data(std::forward<U>(data));
     }
 
 private:
-    Edge<OutwardT> out_edge_; ///< Outward edge owned by this node
+    Edge<OutwardT> out_edge_;  ///< Outward edge owned by this node
+    std::exception_ptr error_; ///< Failure forwarded through out_edge_
 };
 
 } // namespace tw
@@ -14,6 +14,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <exception>
 #include <mutex>
 #include <utility>
 
@@ -34,10 +35,23 @@ namespace tw {
  * 2. Set state to Running and record start time
  * 3. Retrieve input values from inward edges
  * 4. Execute the wrapped callable
- * 5. Store result and set outward edge data
- * 6. Record end time and set state to Complete
+ * 5. Record end time and move the result into the outward edge
+ * 6. Set state to Complete
  * 7. Notify waiting threads
  *
+ * The outward edge is the single owner of the result; get_result() reads it.
+ *
+ * Failure:
+ * - An exception thrown by the callable is captured: the state becomes Failed and
+ *   the outward edge is marked failed, so run() never throws into the worker
+ * - A task whose inward edge failed skips its callable and forwards the same
+ *   exception (Failed), or becomes Cancelled if the failure is a cancellation
+ *
+ * Cancellation:
+ * - Input waits end early when the run's stop token (this_task::get_stop_token())
+ *   is stopped or the task's deadline (set_deadline()) passes; the task is then
+ *   dropped as Cancelled (TaskCancelled or DeadlineExceeded) instead of started
+ *
  * Thread Safety:
  * - Uses condition variable for wait() synchronization
  * - State is atomic (via ITask)
@@ -61,6 +75,8 @@ private:
     using SuperTask = ITask;
 
 public:
+    using SuperTask::get_exception;
+
     /**
      * @brief Executes the task logic.
      *
@@ -69,37 +85,58 @@ public:
      * 2. Sets state to Running and records start time
      * 3. Retrieves input values from inward edges (filtering void types)
      * 4. Invokes the wrapped callable with inputs
-     * 5. Stores the result
-     * 6. Sets the outward edge data for successor tasks
-     * 7. Records end time and sets state to Complete
+     * 5. Records end time
+     * 6. Moves the result into the outward edge for successor tasks
+     * 7. Sets state to Complete
      * 8. Notifies one waiting thread
      *
+     * A failed inward edge skips steps 3-6; an exception thrown by the callable is
+     * captured. Either way the outward edge is marked failed instead (state Failed
+     * or Cancelled).
+     *
      * @note Called by ThreadPool worker threads.
      * @note Blocks until all dependencies complete.
      */
     virtual void run() override
     {
-        for (const auto edge : SuperNode::get_inward_edges()) {
-            if (edge) {
-                edge->wait_until_retrievable();
-            }
+        std::exception_ptr error = wait_for_inputs();
+        if (error) {
+            finish(std::move(error));
+            return;
         }
         set_state(TaskState::Running);
         set_start_time(std::chrono::steady_clock::now());
 
         // Get input values and call the function with them
-        if constexpr (sizeof...(InputTs) == 0) {
-            result_ = callable_();
+        try {
+            ReturnT result = [this]() {
+                if constexpr (sizeof...(InputTs) == 0) {
+                    return callable_();
+                }
+                else {
+                    return run_impl(typename integer_sequence_void_filter<InputTs...>::filtered{});
+                }
+            }();
+            set_end_time(std::chrono::steady_clock::now());
+            SuperNode::set_out_edge_data(std::move(result));
         }
-        else {
-            result_ = run_impl(typename integer_sequence_void_filter<InputTs...>::filtered{});
+        catch (...) {
+            set_end_time(std::chrono::steady_clock::now());
+            error = std::current_exception();
         }
+        finish(std::move(error));
+    }
 
-        set_end_time(std::chrono::steady_clock::now());
-        SuperNode::set_out_edge_data(result_);
-        set_state(TaskState::Complete);
-        std::lock_guard lk{mtx_};
-        cv_.notify_one();
+    /**
+     * @brief Finishes the task as Cancelled without running it.
+     *
+     * Dependents see TaskCancelled on their inward edge and are cancelled in turn.
+     *
+     * @note Must not be called while the task is running.
+     */
+    virtual void cancel() override
+    {
+        finish(task_cancelled_exception());
     }
 
     /**
@@ -116,11 +153,24 @@ public:
         return callable_(SuperNode::template get_inward_edge_value<Idx>()...);
     }
 
+    /**
+     * @brief Returns the task to its initial state so it can run again.
+     *
+     * Sets the state to Incomplete and marks the outward edge as not retrievable.
+     *
+     * @note Must not be called while the task or its consumers are running.
+     */
+    virtual void reset() override
+    {
+        SuperNode::reset_out_edge();
+        set_state(TaskState::Incomplete);
+    }
+
     /**
      * @brief Blocks until task execution completes.
-     * @return TaskState after completion (should be Complete).
+     * @return TaskState after completion (Complete, Failed or Cancelled).
      *
-     * Waits on condition variable until state becomes TaskState::Complete.
+     * Waits on condition variable until the task has finished.
      * Safe to call from any thread.
      *
      * @note Thread-safe: uses mutex and condition variable.
@@ -129,7 +179,7 @@ public:
     {
         std::unique_lock lk{mtx_};
         cv_.wait(lk, [this]() {
-            return get_state() == TaskState::Complete;
+            return is_finished();
         });
         return get_state();
     }
@@ -166,13 +216,28 @@ public:
 
     /**
      * @brief Returns the computed result of the task.
-     * @return Copy of the result value.
+     * @return Copy of the result value, read from the outward edge.
+     *
+     * Should be called after wait() returns to ensure result is ready. A Failed or
+     * Cancelled task has no result; see get_exception().
      *
-     * Should be called after wait() returns to ensure result is ready.
+     * @warning With EdgeTransferMode::MoveToLastConsumer the result is moved out
+     *          once the last consumer has run.
      */
     auto get_result() const noexcept -> ReturnT
     {
-        return result_;
+        return SuperNode::get_outward_edge()->get_data();
+    }
+
+    /**
+     * @brief Returns a const reference to the computed result, without copying.
+     * @return Reference to the value held by the outward edge.
+     *
+     * Same validity rules as get_result().
+     */
+    auto get_result_ref() const noexcept -> const ReturnT&
+    {
+        return SuperNode::get_outward_edge()->get_data_ref();
     }
 
     /**
@@ -192,10 +257,50 @@ public:
     }
 
 private:
-    typename function_from_tuple<ReturnT, remove_voids<InputTs...>>::type callable_;  ///< Wrapped callable
-    ReturnT result_;                                                                  ///< Computed result
-    mutable std::condition_variable cv_;                                              ///< Completion notifier
-    mutable std::mutex mtx_;                                                          ///< Protects wait
+    /**
+     * @brief Waits for all inward edges, unless the run is stopped or the deadline passes first.
+     * @return Exception of the first failed inward edge, the cancellation that
+     *         drops the task, or nullptr if the task may start.
+     */
+    auto wait_for_inputs() const -> std::exception_ptr
+    {
+        const detail::TaskContext& context = detail::get_task_context();
+        std::exception_ptr error;
+        for (size_t i = 0; i < SuperNode::get_inward_edges_count(); i++) {
+            if (const auto edge = SuperNode::get_inward_edge(i)) {
+                if (!wait_for_input(*edge, context)) {
+                    return get_stop_reason(context);
+                }
+                if (!error && edge->has_failed()) {
+                    error = SuperNode::get_inward_exception(i);
+                }
+            }
+        }
+        return error ? error : get_stop_reason(context);
+    }
+
+    /**
+     * @brief Publishes the outcome of the task and wakes wait().
+     * @param error Failure to forward to the outward edge, or nullptr on success.
+     */
+    auto finish(std::exception_ptr error) noexcept -> void
+    {
+        if (!error) {
+            set_state(TaskState::Complete);
+        }
+        else {
+            const bool is_cancelled = is_cancellation(error);
+            SuperNode::set_out_edge_failed(std::move(error));
+            set_state(is_cancelled ? TaskState::Cancelled : TaskState::Failed);
+        }
+        std::lock_guard lk{mtx_};
+        cv_.notify_one();
+    }
+
+private:
+    typename unique_function_from_tuple<ReturnT, remove_voids<InputTs...>>::type callable_; ///< Wrapped callable
+    mutable std::condition_variable cv_;                                                     ///< Completion notifier
+    mutable std::mutex mtx_;                                                                 ///< Protects wait
 };
 
 /**
@@ -217,6 +322,8 @@ private:
     using SuperTask = ITask;
 
 public:
+    using SuperTask::get_exception;
+
     /**
      * @brief Executes the task logic (void return specialization).
      *
@@ -229,33 +336,50 @@ public:
      * 6. Records end time and sets state to Complete
      * 7. Notifies one waiting thread
      *
+     * Failures are handled as in the primary template.
+     *
      * @note Called by ThreadPool worker threads.
      * @note Blocks until all dependencies complete.
      */
     virtual void run() override
     {
         // Wait for all dependencies
-        for (const auto edge : SuperNode::get_inward_edges()) {
-            if (edge) {
-                edge->wait_until_retrievable();
-            }
+        std::exception_ptr error = wait_for_inputs();
+        if (error) {
+            finish(std::move(error));
+            return;
         }
         set_state(TaskState::Running);
         set_start_time(std::chrono::steady_clock::now());
 
         // Get input values and call the function with them
-        if constexpr (sizeof...(InputTs) == 0) {
-            callable_();
+        try {
+            if constexpr (sizeof...(InputTs) == 0) {
+                callable_();
+            }
+            else {
+                run_impl(typename integer_sequence_void_filter<InputTs...>::filtered{});
+            }
         }
-        else {
-            run_impl(typename integer_sequence_void_filter<InputTs...>::filtered{});
+        catch (...) {
+            error = std::current_exception();
         }
 
         set_end_time(std::chrono::steady_clock::now());
-        SuperNode::set_out_edge_data();
-        set_state(TaskState::Complete);
-        std::lock_guard lk{mtx_};
-        cv_.notify_one();
+        if (!error) {
+            SuperNode::set_out_edge_data();
+        }
+        finish(std::move(error));
+    }
+
+    /**
+     * @brief Finishes the task as Cancelled without running it.
+     *
+     * @note Must not be called while the task is running.
+     */
+    virtual void cancel() override
+    {
+        finish(task_cancelled_exception());
     }
 
     /**
@@ -270,11 +394,24 @@ public:
         callable_(SuperNode::template get_inward_edge_value<Idx>()...);
     }
 
+    /**
+     * @brief Returns the task to its initial state so it can run again.
+     *
+     * Sets the state to Incomplete and marks the outward edge as not retrievable.
+     *
+     * @note Must not be called while the task or its consumers are running.
+     */
+    virtual void reset() override
+    {
+        SuperNode::reset_out_edge();
+        set_state(TaskState::Incomplete);
+    }
+
     /**
      * @brief Blocks until task execution completes.
-     * @return TaskState after completion (should be Complete).
+     * @return TaskState after completion (Complete, Failed or Cancelled).
      *
-     * Waits on condition variable until state becomes TaskState::Complete.
+     * Waits on condition variable until the task has finished.
      *
      * @note Thread-safe: uses mutex and condition variable.
      */
@@ -282,7 +419,7 @@ public:
     {
         std::unique_lock lk{mtx_};
         cv_.wait(lk, [this]() {
-            return get_state() == TaskState::Complete;
+            return is_finished();
         });
         return get_state();
     }
@@ -334,9 +471,50 @@ public:
     }
 
 private:
-    typename function_from_tuple<void, remove_voids<InputTs...>>::type callable_;  ///< Wrapped callable
-    mutable std::condition_variable cv_;                                           ///< Completion notifier
-    mutable std::mutex mtx_;                                                       ///< Protects wait
+    /**
+     * @brief Waits for all inward edges, unless the run is stopped or the deadline passes first.
+     * @return Exception of the first failed inward edge, the cancellation that
+     *         drops the task, or nullptr if the task may start.
+     */
+    auto wait_for_inputs() const -> std::exception_ptr
+    {
+        const detail::TaskContext& context = detail::get_task_context();
+        std::exception_ptr error;
+        for (size_t i = 0; i < SuperNode::get_inward_edges_count(); i++) {
+            if (const auto edge = SuperNode::get_inward_edge(i)) {
+                if (!wait_for_input(*edge, context)) {
+                    return get_stop_reason(context);
+                }
+                if (!error && edge->has_failed()) {
+                    error = SuperNode::get_inward_exception(i);
+                }
+            }
+        }
+        return error ? error : get_stop_reason(context);
+    }
+
+    /**
+     * @brief Publishes the outcome of the task and wakes wait().
+     * @param error Failure to forward to the outward edge, or nullptr on success.
+     */
+    auto finish(std::exception_ptr error) noexcept -> void
+    {
+        if (!error) {
+            set_state(TaskState::Complete);
+        }
+        else {
+            const bool is_cancelled = is_cancellation(error);
+            SuperNode::set_out_edge_failed(std::move(error));
+            set_state(is_cancelled ? TaskState::Cancelled : TaskState::Failed);
+        }
+        std::lock_guard lk{mtx_};
+        cv_.notify_one();
+    }
+
+private:
+    typename unique_function_from_tuple<void, remove_voids<InputTs...>>::type callable_; ///< Wrapped callable
+    mutable std::condition_variable cv_;                                                  ///< Completion notifier
+    mutable std::mutex mtx_;                                                              ///< Protects wait
 };
 
 } // namespace tw
@@ -0,0 +1,180 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <chrono>
+#include <stop_token>
+#include <utility>
+
+namespace tw {
+
+namespace detail {
+
+/**
+ * @brief Cancellation and deadline of the graph run a job belongs to.
+ *
+ * Owned by the executor for the duration of a run and installed on the worker
+ * thread (TaskContextScope) around every job of that run.
+ */
+struct TaskContext {
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    std::stop_token stop_token;            ///< Stopped by cancel(), a fail-fast failure or the deadline
+    TimePoint deadline = TimePoint::max(); ///< Deadline of the run, max() for none
+};
+
+inline thread_local const TaskContext* current_task_context = nullptr; ///< Context of the calling thread's job
+
+/**
+ * @brief Returns the context of the job running on the calling thread.
+ * @return Installed context, or a context that never stops outside of executor jobs.
+ */
+inline auto get_task_context() noexcept -> const TaskContext&
+{
+    static const TaskContext kNone{};
+    return current_task_context != nullptr ? *current_task_context : kNone;
+}
+
+/**
+ * @brief Installs a context for the lifetime of a job, restoring the previous one.
+ */
+class TaskContextScope {
+public:
+    explicit TaskContextScope(const TaskContext* context) noexcept
+        : previous_(std::exchange(current_task_context, context))
+    {
+    }
+
+    ~TaskContextScope()
+    {
+        current_task_context = previous_;
+    }
+
+    // Uncopyable class
+    TaskContextScope(const TaskContextScope&) = delete;
+    auto operator=(const TaskContextScope&) -> TaskContextScope& = delete;
+
+    // Unmovable class
+    TaskContextScope(TaskContextScope&&) = delete;
+    auto operator=(TaskContextScope&&) -> TaskContextScope& = delete;
+
+private:
+    const TaskContext* previous_; ///< Context to restore
+};
+
+/**
+ * @brief Receives notifications when a worker thread is about to block and has resumed.
+ *
+ * Elastic pools install themselves on their workers (current_blocking_observer)
+ * to grow while workers are blocked; see BlockingRegion.
+ */
+class BlockingObserver {
+public:
+    /**
+     * @brief Called on the worker thread before it blocks.
+     */
+    virtual auto on_blocking_begin() noexcept -> void = 0;
+
+    /**
+     * @brief Called on the worker thread once it is runnable again.
+     */
+    virtual auto on_blocking_end() noexcept -> void = 0;
+
+protected:
+    ~BlockingObserver() = default;
+};
+
+inline thread_local BlockingObserver* current_blocking_observer = nullptr; ///< Pool owning the calling worker
+
+} // namespace detail
+
+/**
+ * @brief Marks a scope in which the calling thread blocks without using its CPU.
+ *
+ * Tells the pool owning the calling worker (if it observes blocking, e.g. an
+ * elastic ThreadPool) that the worker is not runnable, so the pool can start
+ * another worker for the queued work. Tasks enter a region while waiting for
+ * their inputs; callables should wrap blocking I/O or locks held by other
+ * threads. Nested regions count once. No-op outside of observing pools.
+ *
+ * Usage:
+ * @code
+ * task.set_callable([] {
+ *     tw::BlockingRegion blocking;
+ *     return read_file(path);
+ * });
+ * @endcode
+ */
+class BlockingRegion {
+public:
+    BlockingRegion() noexcept
+        : observer_(std::exchange(detail::current_blocking_observer, nullptr))
+    {
+        if (observer_ != nullptr) {
+            observer_->on_blocking_begin();
+        }
+    }
+
+    ~BlockingRegion()
+    {
+        if (observer_ != nullptr) {
+            observer_->on_blocking_end();
+        }
+        detail::current_blocking_observer = observer_;
+    }
+
+    // Uncopyable class
+    BlockingRegion(const BlockingRegion&) = delete;
+    auto operator=(const BlockingRegion&) -> BlockingRegion& = delete;
+
+    // Unmovable class
+    BlockingRegion(BlockingRegion&&) = delete;
+    auto operator=(BlockingRegion&&) -> BlockingRegion& = delete;
+
+private:
+    detail::BlockingObserver* observer_; ///< Observer to notify, nullptr inside a nested region
+};
+
+/**
+ * @brief Accessors for the task or job running on the calling thread.
+ *
+ * Callables use them to cooperate with cancellation: a long-running callable
+ * polls stop_requested() (or registers a std::stop_callback on get_stop_token())
+ * and returns early once the run is cancelled or its deadline has passed.
+ */
+namespace this_task {
+
+/**
+ * @brief Returns the stop token of the current run.
+ * @return Token stopped by ThreadPoolExecutor::cancel(), a failure with
+ *         cancel_on_failure, or the run deadline; an empty token outside of executor jobs.
+ */
+inline auto get_stop_token() noexcept -> std::stop_token
+{
+    return detail::get_task_context().stop_token;
+}
+
+/**
+ * @brief Checks whether the current run has been asked to stop.
+ * @return true once the run is cancelled or past its deadline.
+ */
+inline auto stop_requested() noexcept -> bool
+{
+    return detail::get_task_context().stop_token.stop_requested();
+}
+
+/**
+ * @brief Returns the deadline of the current run.
+ * @return Deadline, or time_point::max() if there is none.
+ */
+inline auto get_deadline() noexcept -> std::chrono::steady_clock::time_point
+{
+    return detail::get_task_context().deadline;
+}
+
+} // namespace this_task
+
+} // namespace tw
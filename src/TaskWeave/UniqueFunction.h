@@ -0,0 +1,284 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tw {
+
+/**
+ * @brief Checks whether a callable type has a null state (function pointers, std::function).
+ *
+ * Used by UniqueFunction to turn null callables into an empty UniqueFunction.
+ */
+template<typename FnT>
+struct is_nullable_callable : std::bool_constant<std::is_pointer_v<FnT> || std::is_member_pointer_v<FnT>> {};
+
+template<typename Signature>
+struct is_nullable_callable<std::function<Signature>> : std::true_type {};
+
+template<typename FnT>
+constexpr bool is_nullable_callable_v = is_nullable_callable<FnT>::value;
+
+template<typename Signature, size_t InlineSize = 4 * sizeof(void*)>
+class UniqueFunction;
+
+/**
+ * @brief Move-only, small-buffer-optimized type-erased callable.
+ *
+ * UniqueFunction is a replacement for std::function on hot paths:
+ * - Callables up to InlineSize bytes (and nothrow-movable) are stored inline,
+ *   so wrapping a lambda that captures a few pointers never allocates
+ * - Larger callables fall back to a single heap allocation
+ * - Move-only: accepts move-only captures (e.g. std::unique_ptr) and never
+ *   copies the stored callable
+ *
+ * Like std::function, operator() is const and invokes the stored callable as
+ * non-const, and calling an empty UniqueFunction throws std::bad_function_call.
+ *
+ * @tparam R Return type.
+ * @tparam Args Argument types.
+ * @tparam InlineSize Size of the inline buffer in bytes.
+ *
+ * Usage:
+ * @code
+ * UniqueFunction<int(int)> fn = [p = std::make_unique<int>(2)](int v) { return v * *p; };
+ * int result = fn(21);
+ * @endcode
+ */
+template<typename R, typename... Args, size_t InlineSize>
+class UniqueFunction<R(Args...), InlineSize> {
+private:
+    /**
+     * @brief Per-callable-type operations table.
+     */
+    struct VTable {
+        R (*invoke)(void* storage, Args&&... args);            ///< Calls the stored callable
+        void (*move)(void* destination, void* source) noexcept; ///< Move-constructs into destination, destroys source
+        void (*destroy)(void* storage) noexcept;                ///< Destroys the stored callable
+    };
+
+    template<typename Fn>
+    static constexpr bool is_stored_inline_v = sizeof(Fn) <= InlineSize && alignof(Fn) <= alignof(void*) &&
+                                               std::is_nothrow_move_constructible_v<Fn>;
+
+    /**
+     * @brief Calls a callable as R(Args...), discarding its result when R is void.
+     * @param fn Stored callable.
+     * @param args Arguments forwarded to the callable.
+     * @return Result of the call, converted to R.
+     */
+    template<typename Fn>
+    static auto call(Fn& fn, Args&&... args) -> R
+    {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(fn, std::forward<Args>(args)...);
+        }
+        else {
+            return std::invoke(fn, std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename Fn>
+    static constexpr VTable inline_vtable{
+        [](void* storage, Args&&... args) -> R {
+            return call(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept {
+            ::new (destination) Fn(std::move(*static_cast<Fn*>(source)));
+            static_cast<Fn*>(source)->~Fn();
+        },
+        [](void* storage) noexcept {
+            static_cast<Fn*>(storage)->~Fn();
+        },
+    };
+
+    template<typename Fn>
+    static constexpr VTable heap_vtable{
+        [](void* storage, Args&&... args) -> R {
+            return call(**static_cast<Fn**>(storage), std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept {
+            ::new (destination) Fn*(*static_cast<Fn**>(source));
+        },
+        [](void* storage) noexcept {
+            delete *static_cast<Fn**>(storage);
+        },
+    };
+
+public:
+    /**
+     * @brief Whether a callable of type Fn would be stored without heap allocation.
+     */
+    template<typename Fn>
+    static constexpr bool stores_inline = is_stored_inline_v<std::decay_t<Fn>>;
+
+    /**
+     * @brief Constructs an empty function.
+     */
+    UniqueFunction() noexcept = default;
+
+    /**
+     * @brief Constructs an empty function from nullptr.
+     */
+    UniqueFunction(std::nullptr_t) noexcept
+    {
+    }
+
+    /**
+     * @brief Constructs from a callable, storing it inline when it fits.
+     * @tparam Fn Callable type invocable as R(Args...).
+     * @param fn Callable to store (moved or copied in).
+     *
+     * @note Null function pointers and empty std::function objects produce an empty UniqueFunction.
+     */
+    template<typename Fn>
+        requires(!std::is_same_v<std::remove_cvref_t<Fn>, UniqueFunction> &&
+                 std::is_invocable_r_v<R, std::decay_t<Fn>&, Args...>)
+    UniqueFunction(Fn&& fn)
+    {
+        emplace(std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Move constructor - steals the callable from another function.
+     * @param other Function to move from (left empty).
+     */
+    UniqueFunction(UniqueFunction&& other) noexcept
+    {
+        move_from(other);
+    }
+
+    /**
+     * @brief Move assignment - destroys the current callable and steals another.
+     * @param other Function to move from (left empty).
+     * @return Reference to this function.
+     */
+    auto operator=(UniqueFunction&& other) noexcept -> UniqueFunction&
+    {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Assigns a new callable.
+     * @tparam Fn Callable type invocable as R(Args...).
+     * @param fn Callable to store.
+     * @return Reference to this function.
+     */
+    template<typename Fn>
+        requires(!std::is_same_v<std::remove_cvref_t<Fn>, UniqueFunction> &&
+                 std::is_invocable_r_v<R, std::decay_t<Fn>&, Args...>)
+    auto operator=(Fn&& fn) -> UniqueFunction&
+    {
+        reset();
+        emplace(std::forward<Fn>(fn));
+        return *this;
+    }
+
+    /**
+     * @brief Destroys the stored callable, leaving the function empty.
+     * @return Reference to this function.
+     */
+    auto operator=(std::nullptr_t) noexcept -> UniqueFunction&
+    {
+        reset();
+        return *this;
+    }
+
+    // Uncopyable class
+    UniqueFunction(const UniqueFunction&) = delete;
+    auto operator=(const UniqueFunction&) -> UniqueFunction& = delete;
+
+    /**
+     * @brief Destructor - destroys the stored callable.
+     */
+    ~UniqueFunction()
+    {
+        reset();
+    }
+
+    /**
+     * @brief Invokes the stored callable.
+     * @param args Arguments forwarded to the callable.
+     * @return Result of the call.
+     *
+     * @throws std::bad_function_call if the function is empty.
+     */
+    auto operator()(Args... args) const -> R
+    {
+        if (vtable_ == nullptr) {
+            throw std::bad_function_call();
+        }
+        return vtable_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether a callable is stored.
+     * @return true if not empty.
+     */
+    explicit operator bool() const noexcept
+    {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * @brief Compares against nullptr.
+     * @return true if the function is empty.
+     */
+    friend auto operator==(const UniqueFunction& fn, std::nullptr_t) noexcept -> bool
+    {
+        return fn.vtable_ == nullptr;
+    }
+
+private:
+    template<typename Fn>
+    auto emplace(Fn&& fn) -> void
+    {
+        using StoredT = std::decay_t<Fn>;
+        if constexpr (is_nullable_callable_v<StoredT>) {
+            if (fn == nullptr) {
+                return;
+            }
+        }
+        if constexpr (is_stored_inline_v<StoredT>) {
+            ::new (static_cast<void*>(storage_)) StoredT(std::forward<Fn>(fn));
+            vtable_ = &inline_vtable<StoredT>;
+        }
+        else {
+            ::new (static_cast<void*>(storage_)) StoredT*(new StoredT(std::forward<Fn>(fn)));
+            vtable_ = &heap_vtable<StoredT>;
+        }
+    }
+
+    auto move_from(UniqueFunction& other) noexcept -> void
+    {
+        if (other.vtable_ != nullptr) {
+            other.vtable_->move(storage_, other.storage_);
+            vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    }
+
+    auto reset() noexcept -> void
+    {
+        if (vtable_ != nullptr) {
+            std::exchange(vtable_, nullptr)->destroy(storage_);
+        }
+    }
+
+private:
+    alignas(void*) mutable std::byte storage_[InlineSize]; ///< Inline callable or pointer to heap callable
+    const VTable* vtable_ = nullptr;                       ///< Operations for the stored type (null if empty)
+};
+
+} // namespace tw
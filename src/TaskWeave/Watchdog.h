@@ -0,0 +1,221 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+// STL
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+namespace tw {
+
+/**
+ * @brief Process-wide timer thread that requests stops when deadlines pass.
+ *
+ * Deadlines are registered as (time point, std::stop_source) pairs. A single
+ * background thread, started on first use, sleeps until the earliest deadline
+ * and calls request_stop() on its source; stop callbacks (e.g. the wakeup of a
+ * stop-aware IEdge wait) therefore run on the watchdog thread. They run without
+ * the watchdog lock held, so a callback may register or reset timers itself.
+ *
+ * Timers are RAII handles: destroying one before its deadline unregisters it.
+ *
+ * Usage:
+ * @code
+ * std::stop_source source;
+ * Watchdog::Timer timer(std::chrono::steady_clock::now() + 5ms, source);
+ * edge.wait_until_retrievable(source.get_token()); // gives up after 5 ms
+ * @endcode
+ */
+class Watchdog {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+private:
+    using Key = std::pair<TimePoint, uint64_t>;
+
+public:
+    /**
+     * @brief Registration of one deadline; unregisters it on destruction.
+     */
+    class Timer {
+    public:
+        /**
+         * @brief Creates an empty timer.
+         */
+        Timer() noexcept = default;
+
+        /**
+         * @brief Registers a deadline with the process-wide watchdog.
+         * @param deadline Time point at which source is stopped.
+         * @param source Stop source to stop (shares its stop state with the caller's copy).
+         */
+        Timer(TimePoint deadline, std::stop_source source)
+            : key_(deadline, instance().schedule(deadline, std::move(source)))
+        {
+        }
+
+        Timer(Timer&& other) noexcept
+            : key_(std::exchange(other.key_, Key{}))
+        {
+        }
+
+        auto operator=(Timer&& other) noexcept -> Timer&
+        {
+            if (this != &other) {
+                reset();
+                key_ = std::exchange(other.key_, Key{});
+            }
+            return *this;
+        }
+
+        ~Timer()
+        {
+            reset();
+        }
+
+        // Uncopyable class
+        Timer(const Timer&) = delete;
+        auto operator=(const Timer&) -> Timer& = delete;
+
+        /**
+         * @brief Unregisters the deadline if it has not fired yet.
+         */
+        auto reset() noexcept -> void
+        {
+            if (key_.second != 0) {
+                instance().cancel(std::exchange(key_, Key{}));
+            }
+        }
+
+    private:
+        Key key_{}; ///< Deadline and registration id (0 when empty)
+    };
+
+    /**
+     * @brief Returns the process-wide watchdog.
+     * @return Watchdog whose thread starts on the first registration.
+     */
+    static auto instance() -> Watchdog&
+    {
+        static Watchdog watchdog;
+        return watchdog;
+    }
+
+    /**
+     * @brief Stops the watchdog thread; pending deadlines are dropped.
+     */
+    ~Watchdog()
+    {
+        {
+            std::lock_guard lck{mtx_};
+            is_shutting_down_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Uncopyable class
+    Watchdog(const Watchdog&) = delete;
+    auto operator=(const Watchdog&) -> Watchdog& = delete;
+
+    // Unmovable class
+    Watchdog(Watchdog&&) = delete;
+    auto operator=(Watchdog&&) -> Watchdog& = delete;
+
+private:
+    Watchdog() = default;
+
+    /**
+     * @brief Registers a deadline.
+     * @param deadline Time point at which source is stopped.
+     * @param source Stop source to stop.
+     * @return Registration id (with the deadline, the key for cancel()).
+     */
+    auto schedule(TimePoint deadline, std::stop_source source) -> uint64_t
+    {
+        uint64_t id = 0;
+        bool is_earliest = false;
+        {
+            std::lock_guard lck{mtx_};
+            if (!thread_.joinable()) {
+                thread_ = std::thread([this]() {
+                    loop();
+                });
+            }
+            id = ++last_id_;
+            auto it = deadlines_.emplace(Key{deadline, id}, std::move(source)).first;
+            is_earliest = it == deadlines_.begin();
+        }
+        if (is_earliest) {
+            cv_.notify_one();
+        }
+        return id;
+    }
+
+    /**
+     * @brief Unregisters a deadline.
+     * @param key Deadline and registration id returned by schedule().
+     *
+     * @note After return the source is not stopped by this registration: if it is
+     *       firing, waits for request_stop() to return (unless called from its stop callback).
+     */
+    auto cancel(const Key& key) noexcept -> void
+    {
+        std::unique_lock lck{mtx_};
+        if (deadlines_.erase(key) == 0 && std::this_thread::get_id() != thread_.get_id()) {
+            fired_cv_.wait(lck, [this, &key]() {
+                return firing_id_ != key.second;
+            });
+        }
+    }
+
+    /**
+     * @brief Watchdog thread: sleeps until the earliest deadline and stops its source.
+     */
+    auto loop() -> void
+    {
+        std::unique_lock lck{mtx_};
+        while (!is_shutting_down_) {
+            if (deadlines_.empty()) {
+                cv_.wait(lck);
+                continue;
+            }
+            auto earliest = deadlines_.begin();
+            if (std::chrono::steady_clock::now() < earliest->first.first) {
+                cv_.wait_until(lck, earliest->first.first);
+                continue;
+            }
+            // Stop outside the lock, as stop callbacks may use the watchdog; cancel() waits on firing_id_
+            std::stop_source source = std::move(earliest->second);
+            firing_id_ = earliest->first.second;
+            deadlines_.erase(earliest);
+            lck.unlock();
+            source.request_stop();
+            lck.lock();
+            firing_id_ = 0;
+            fired_cv_.notify_all();
+        }
+    }
+
+private:
+    std::map<Key, std::stop_source> deadlines_; ///< Pending deadlines, earliest first
+    std::mutex mtx_;                            ///< Protects deadlines_, firing_id_ and the thread handle
+    std::condition_variable cv_;                ///< Wakes the thread on new earliest deadline or shutdown
+    std::condition_variable fired_cv_;          ///< Wakes cancel() once the firing registration has been stopped
+    std::thread thread_;                        ///< Watchdog thread, started on first registration
+    uint64_t last_id_ = 0;                      ///< Last registration id handed out
+    uint64_t firing_id_ = 0;                    ///< Registration whose source is being stopped (0 if none)
+    bool is_shutting_down_ = false;             ///< Set by the destructor
+};
+
+} // namespace tw
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "Executor/CoTask.h"
 #include "Executor/ThreadPoolExecutor.h"
 #include "TaskWeave/Task.h"
 #include "stress_test_utils.h"
@@ -11,6 +12,8 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -603,4 +606,336 @@ TEST(StressDependentTasks, MixedDependencyGraph_5K)
     print_timing_result("MixedDependencyGraph_5K", result);
 }
 
+/**
+ * @brief Stress test: Mixed dependency graph with dependency-driven dispatch
+ *
+ * Same shape as MixedDependencyGraph_5K, but tasks are only submitted to the
+ * pool once their predecessors complete, so no worker blocks on an edge.
+ */
+TEST(StressDependentTasks, MixedDependencyGraph_5K_DependencyDriven)
+{
+    constexpr size_t kIndependentCount = 1000;
+    constexpr size_t kChainCount = 500;
+    constexpr size_t kDiamondCount = 125; // 125 * 4 = 500 tasks
+    constexpr size_t kFanOutProducers = 10;
+    constexpr size_t kFanOutConsumersPerProducer = 200;
+
+    const size_t kDiamondTasks = kDiamondCount * 4;
+    const size_t kFanOutConsumers = kFanOutProducers * kFanOutConsumersPerProducer;
+    const size_t kTotalTasks = kIndependentCount + kChainCount + kDiamondTasks + kFanOutProducers + kFanOutConsumers;
+
+    std::atomic<size_t> counter{0};
+
+    std::vector<Task<void>> independent = generate_independent_void_tasks(kIndependentCount, counter);
+    std::vector<Task<int, int>> chain = generate_linear_chain(kChainCount);
+    std::vector<Task<int, int, int>> diamonds = generate_diamond_pattern(kDiamondCount);
+    std::vector<std::pair<std::unique_ptr<Task<int>>, std::vector<Task<int, int>>>> fan_outs;
+    fan_outs.reserve(kFanOutProducers);
+    for (size_t i = 0; i < kFanOutProducers; ++i) {
+        fan_outs.push_back(generate_fan_out(kFanOutConsumersPerProducer));
+    }
+
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    for (auto& task : independent) {
+        executor.add_task(&task);
+    }
+    for (auto& task : chain) {
+        executor.add_task(&task);
+    }
+    for (auto& task : diamonds) {
+        executor.add_task(&task);
+    }
+    for (auto& [producer, consumers] : fan_outs) {
+        executor.add_task(producer.get());
+        for (auto& consumer : consumers) {
+            executor.add_task(&consumer);
+        }
+    }
+
+    // Execute
+    auto start = Clock::now();
+    executor.run();
+    executor.wait();
+    auto end = Clock::now();
+
+    // Validate
+    EXPECT_EQ(counter.load(), kIndependentCount) << "Not all independent tasks executed";
+
+    EXPECT_TRUE(verify_linear_chain_results(chain, static_cast<int>(kChainCount))) << "Chain results incorrect";
+
+    EXPECT_TRUE(verify_diamond_results(diamonds, kDiamondCount)) << "Diamond results incorrect";
+
+    // Report
+    TimingResult result{
+        .total = std::chrono::duration_cast<Duration>(end - start),
+        .min_task = DurationMicro{0},
+        .max_task = DurationMicro{0},
+        .avg_task_ms = std::chrono::duration_cast<Duration>(end - start).count() / static_cast<double>(kTotalTasks),
+        .tasks_per_second = kTotalTasks * 1000.0 / std::chrono::duration_cast<Duration>(end - start).count()};
+    print_timing_result("MixedDependencyGraph_5K_DependencyDriven", result);
+}
+
+/**
+ * @brief Stress test: Unbalanced DAG, FIFO vs critical-path scheduling
+ *
+ * Pattern: one chain of kChainLength tasks plus kFillerCount independent tasks,
+ * every task sleeping kTaskDuration, on kWorkers workers. The filler tasks are
+ * added first, so FIFO starts the chain late and then queues every chain link
+ * behind the remaining filler. Critical-path scheduling keeps the chain running.
+ *
+ * Sleeping tasks make the makespan independent of the machine's core count.
+ */
+TEST(StressDependentTasks, UnbalancedDAG_CriticalPath)
+{
+    constexpr size_t kWorkers = 4;
+    constexpr size_t kChainLength = 10;
+    constexpr size_t kFillerCount = 60;
+    constexpr auto kTaskDuration = std::chrono::milliseconds(2);
+
+    auto measure = [&](SchedulingPolicy policy) {
+        std::vector<Task<void>> filler(kFillerCount);
+        std::vector<std::unique_ptr<Task<void, void>>> chain;
+        Task<void> chain_head;
+        chain_head.set_callable([&]() {
+            std::this_thread::sleep_for(kTaskDuration);
+        });
+        for (auto& task : filler) {
+            task.set_callable([&]() {
+                std::this_thread::sleep_for(kTaskDuration);
+            });
+        }
+        for (size_t i = 0; i < kChainLength - 1; ++i) {
+            chain.push_back(std::make_unique<Task<void, void>>());
+            chain.back()->set_callable([&]() {
+                std::this_thread::sleep_for(kTaskDuration);
+            });
+            chain.back()->add_inward_edge<0>(i == 0 ? chain_head.get_outward_edge() : chain[i - 1]->get_outward_edge());
+        }
+
+        ThreadPoolExecutor executor(
+            std::make_unique<ThreadPool>(kWorkers),
+            ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven, .scheduling_policy = policy});
+        for (auto& task : filler) {
+            executor.add_task(&task);
+        }
+        executor.add_task(&chain_head);
+        for (auto& task : chain) {
+            executor.add_task(task.get());
+        }
+
+        auto start = Clock::now();
+        executor.run();
+        executor.wait();
+        auto end = Clock::now();
+
+        EXPECT_EQ(chain.back()->get_state(), TaskState::Complete);
+        return std::chrono::duration_cast<Duration>(end - start);
+    };
+
+    const auto fifo = measure(SchedulingPolicy::Fifo);
+    const auto critical_path = measure(SchedulingPolicy::CriticalPath);
+
+    // Report
+    std::cout << "=== UnbalancedDAG_CriticalPath (" << kChainLength << "-task chain + " << kFillerCount
+              << " independent, " << kWorkers << " workers) ===\n";
+    std::cout << "  FIFO makespan:          " << fifo.count() << " ms\n";
+    std::cout << "  Critical-path makespan: " << critical_path.count() << " ms\n";
+}
+
+/**
+ * @brief Stress test: Chain passing a large vector, copy vs move transfer
+ *
+ * Pattern: T0 -> T1 -> ... -> T199, each task appending to a 256K-element vector
+ * received from its predecessor. Compares EdgeTransferMode::Copy with
+ * EdgeTransferMode::MoveToLastConsumer, where the vector is never copied.
+ */
+TEST(StressDependentTasks, LargePayloadChain_MoveTransfer)
+{
+    constexpr size_t kChainLength = 200;
+    constexpr size_t kPayloadSize = 256 * 1024;
+
+    auto measure = [&](EdgeTransferMode mode) {
+        Task<std::vector<int>> head;
+        head.set_callable([]() {
+            return std::vector<int>(kPayloadSize, 1);
+        });
+        head.set_out_edge_transfer_mode(mode);
+
+        std::vector<std::unique_ptr<Task<std::vector<int>, std::vector<int>>>> chain;
+        chain.reserve(kChainLength - 1);
+        for (size_t i = 0; i < kChainLength - 1; ++i) {
+            chain.push_back(std::make_unique<Task<std::vector<int>, std::vector<int>>>());
+            chain.back()->set_callable([](std::vector<int> payload) {
+                payload[0]++;
+                return payload;
+            });
+            chain.back()->set_out_edge_transfer_mode(mode);
+            chain.back()->add_inward_edge<std::vector<int>>(i == 0 ? head.get_outward_edge()
+                                                                   : chain[i - 1]->get_outward_edge());
+        }
+
+        ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+        executor.add_task(&head);
+        for (auto& task : chain) {
+            executor.add_task(task.get());
+        }
+
+        auto start = Clock::now();
+        executor.run();
+        executor.wait();
+        auto end = Clock::now();
+
+        EXPECT_EQ(chain.back()->get_result_ref()[0], static_cast<int>(kChainLength));
+        return std::chrono::duration_cast<DurationMicro>(end - start);
+    };
+
+    const auto copy = measure(EdgeTransferMode::Copy);
+    const auto move = measure(EdgeTransferMode::MoveToLastConsumer);
+
+    // Report
+    std::cout << "=== LargePayloadChain_MoveTransfer (" << kChainLength << " tasks, " << kPayloadSize
+              << " ints) ===\n";
+    std::cout << "  Copy transfer:          " << copy.count() << " μs\n";
+    std::cout << "  Move-to-last transfer:  " << move.count() << " μs\n";
+}
+
+/**
+ * @brief Stress test: Linear chain of 1,000 tasks, queued vs continued inline
+ *
+ * Pattern: T0 -> T1 -> ... -> T999, dependency-driven. With max_continuation_depth = 0
+ * every link goes through the thread pool queue; with the default depth each ready
+ * successor runs on the worker that finished its predecessor.
+ */
+TEST(StressDependentTasks, LinearChain_1K_Continuation)
+{
+    constexpr size_t kTaskCount = kTaskCount_Light; // 1000
+    constexpr size_t kIterations = 20;
+
+    auto measure = [&](uint32_t depth) {
+        std::vector<Task<int, int>> tasks = generate_linear_chain(kTaskCount);
+        std::vector<ITask*> task_ptrs;
+        for (auto& task : tasks) {
+            task_ptrs.emplace_back(&task);
+        }
+        CompiledGraph graph{task_ptrs};
+        ThreadPoolExecutor executor(
+            ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven, .max_continuation_depth = depth});
+
+        auto start = Clock::now();
+        for (size_t iteration = 0; iteration < kIterations; ++iteration) {
+            executor.run(graph);
+            executor.wait();
+        }
+        auto end = Clock::now();
+
+        EXPECT_TRUE(verify_linear_chain_results(tasks, static_cast<int>(kTaskCount)));
+        return std::chrono::duration_cast<DurationMicro>(end - start).count() / static_cast<double>(kIterations);
+    };
+
+    const auto queued = measure(0);
+    const auto continued = measure(ExecutorOptions{}.max_continuation_depth);
+
+    // Report
+    std::cout << "=== LinearChain_1K_Continuation (" << kTaskCount << " tasks x " << kIterations << " runs) ===\n";
+    std::cout << "  Queued per run:         " << queued << " μs\n";
+    std::cout << "  Continued per run:      " << continued << " μs\n";
+}
+
+/**
+ * @brief Stress test: Latency-bound requests, blocking tasks vs coroutines
+ *
+ * Pattern: kRequests requests on kWorkers workers, each starting a simulated
+ * I/O operation (kIoLatency on an external thread) and then consuming its result.
+ * A blocking Task holds its worker for the whole latency, so only kWorkers
+ * operations are in flight; a CoTask suspends on the edge and frees the worker.
+ */
+TEST(StressDependentTasks, LatencyBoundRequests_Coroutine)
+{
+    constexpr size_t kWorkers = 2;
+    constexpr size_t kRequests = 32;
+    constexpr auto kIoLatency = std::chrono::milliseconds(5);
+
+    std::mutex io_mtx;
+    std::vector<std::thread> io_threads;
+    auto start_io = [&](Task<int>& operation) {
+        std::lock_guard lck{io_mtx};
+        io_threads.emplace_back([&operation, kIoLatency]() {
+            std::this_thread::sleep_for(kIoLatency);
+            operation.run();
+        });
+    };
+    auto join_io = [&]() {
+        for (auto& thread : io_threads) {
+            thread.join();
+        }
+        io_threads.clear();
+    };
+    auto make_operations = []() {
+        std::vector<Task<int>> operations(kRequests);
+        for (auto& operation : operations) {
+            operation.set_callable([]() -> int {
+                return 1;
+            });
+        }
+        return operations;
+    };
+
+    // Blocking: the consumer task waits for its input inside the worker
+    std::vector<Task<int>> blocking_operations = make_operations();
+    std::vector<Task<int, int>> consumers(kRequests);
+    ThreadPool blocking_pool(kWorkers);
+    blocking_pool.run();
+    auto blocking_start = Clock::now();
+    for (size_t i = 0; i < kRequests; ++i) {
+        consumers[i].set_callable([](int value) -> int {
+            return value + 1;
+        });
+        consumers[i].add_inward_edge<int>(blocking_operations[i].get_outward_edge());
+        blocking_pool.add_task([&, i]() {
+            start_io(blocking_operations[i]);
+            consumers[i].run();
+        });
+    }
+    blocking_pool.wait();
+    auto blocking_end = Clock::now();
+    join_io();
+
+    // Coroutines: the request suspends on the edge and releases the worker
+    std::vector<Task<int>> co_operations = make_operations();
+    auto request = [&start_io](Task<int>& operation) -> CoTask<int> {
+        start_io(operation);
+        const int& value = co_await operation;
+        co_return value + 1;
+    };
+    std::vector<CoTask<int>> requests;
+    ThreadPool co_pool(kWorkers);
+    co_pool.run();
+    auto co_start = Clock::now();
+    for (size_t i = 0; i < kRequests; ++i) {
+        requests.push_back(request(co_operations[i]));
+        requests.back().start(co_pool);
+    }
+    for (auto& co_task : requests) {
+        co_task.wait();
+    }
+    auto co_end = Clock::now();
+    co_pool.wait();
+    join_io();
+
+    // Validate
+    for (size_t i = 0; i < kRequests; ++i) {
+        EXPECT_EQ(consumers[i].get_result(), 2);
+        EXPECT_EQ(requests[i].get_result(), 2);
+    }
+
+    // Report
+    auto blocking = std::chrono::duration_cast<Duration>(blocking_end - blocking_start);
+    auto coroutine = std::chrono::duration_cast<Duration>(co_end - co_start);
+    std::cout << "=== LatencyBoundRequests_Coroutine (" << kRequests << " requests, " << kIoLatency.count()
+              << " ms latency, " << kWorkers << " workers) ===\n";
+    std::cout << "  Blocking tasks:         " << blocking.count() << " ms\n";
+    std::cout << "  Coroutines:             " << coroutine.count() << " ms\n";
+}
+
 } // namespace tw::stress
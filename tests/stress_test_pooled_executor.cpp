@@ -2,16 +2,22 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "Executor/TaskGroup.h"
 #include "Executor/ThreadPoolExecutor.h"
+#include "Executor/Tracer.h"
 #include "TaskWeave/Task.h"
 #include "stress_test_utils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace tw::stress {
@@ -248,6 +254,67 @@ TEST(StressPooledExecutor, Executor_CancelUnderLoad)
     std::cout << "  Tasks cancelled: " << (kTaskCount - executed) << "\n";
 }
 
+/**
+ * @brief Stress test: 10,000-task graph whose first task throws, with and without cancel_on_failure
+ *
+ * Pattern: kChainCount chains of kChainLength CPU-bound tasks; the head of the
+ * first chain throws. Without fail-fast only that chain is skipped and the rest
+ * of the graph still runs; with ExecutorOptions::cancel_on_failure the remaining
+ * tasks are cancelled as soon as the failure is recorded.
+ */
+TEST(StressPooledExecutor, Executor_FailFast_10K)
+{
+    constexpr size_t kChainCount = 100;
+    constexpr size_t kChainLength = kTaskCount_Heavy / kChainCount; // 10000 tasks
+    constexpr auto kWork = std::chrono::microseconds(20);
+
+    auto measure = [&](bool cancel_on_failure) {
+        std::atomic<size_t> executed{0};
+        std::vector<Task<void, void>> tasks(kChainCount * kChainLength);
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            tasks[i].set_callable([&executed, i, kWork]() {
+                if (i == 0) {
+                    throw std::runtime_error("corrupt input");
+                }
+                const auto until = Clock::now() + kWork;
+                while (Clock::now() < until) {
+                }
+                executed.fetch_add(1, std::memory_order_relaxed);
+            });
+            if (i % kChainLength != 0) {
+                tasks[i].add_inward_edge<void>(tasks[i - 1].get_outward_edge());
+            }
+        }
+
+        ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven,
+                                                    .cancel_on_failure = cancel_on_failure});
+        for (auto& task : tasks) {
+            executor.add_task(&task);
+        }
+        auto start = Clock::now();
+        executor.run();
+        executor.wait();
+        auto end = Clock::now();
+
+        EXPECT_EQ(executor.get_failed_task(), &tasks[0]);
+        for (const auto& task : tasks) {
+            EXPECT_TRUE(task.is_finished());
+        }
+        return std::make_pair(std::chrono::duration_cast<DurationMicro>(end - start), executed.load());
+    };
+
+    const auto [skip_time, skip_executed] = measure(false);
+    const auto [cancel_time, cancel_executed] = measure(true);
+    EXPECT_EQ(skip_executed, (kChainCount - 1) * kChainLength);
+    EXPECT_LT(cancel_executed, skip_executed);
+
+    // Report
+    std::cout << "=== Executor_FailFast_10K (" << kChainCount << " chains of " << kChainLength << ") ===\n";
+    std::cout << "  Skip dependents only:   " << skip_time.count() << " μs (" << skip_executed << " tasks run)\n";
+    std::cout << "  cancel_on_failure:      " << cancel_time.count() << " μs (" << cancel_executed
+              << " tasks run)\n";
+}
+
 // ============================================================================
 // Executor Thread Scaling Tests
 // ============================================================================
@@ -303,48 +370,97 @@ TEST(StressPooledExecutor, Executor_VaryingThreadCounts)
 // ============================================================================
 
 /**
- * @brief Stress test: Repeated executor use
+ * @brief Stress test: Repeated execution of the same 2K-node graph
+ *
+ * Runs a layered 2000-task graph once per "frame", comparing:
+ * - Rebuild: a fresh executor per frame (reachability, sort, new thread pool)
+ * - Compiled: one CompiledGraph reset and re-run on a persistent executor
  *
- * Tests that executor can be recreated and reused multiple times
- * without resource leaks or state corruption.
+ * Reports the per-iteration cost in microseconds.
  */
 TEST(StressPooledExecutor, Executor_RepeatedUse)
 {
-    constexpr size_t kBatchCount = 100;
-    constexpr size_t kTasksPerBatch = 100;
-    constexpr size_t kTotalCount = kBatchCount * kTasksPerBatch;
-
-    std::atomic<size_t> counter{0};
+    constexpr size_t kIterations = 100;
+    constexpr size_t kLevel0Count = 10;
+    constexpr size_t kLevel1Count = 190;
+    constexpr size_t kLevel2Count = 1800;
+    constexpr size_t kTotalTasks = kLevel0Count + kLevel1Count + kLevel2Count;
 
-    auto start = Clock::now();
+    std::vector<Task<int>> level0(kLevel0Count);
+    std::vector<Task<int, int>> level1(kLevel1Count);
+    std::vector<Task<int, int>> level2(kLevel2Count);
+    std::vector<ITask*> all_tasks;
+    all_tasks.reserve(kTotalTasks);
 
-    for (size_t batch = 0; batch < kBatchCount; ++batch) {
-        std::vector<Task<void>> tasks = generate_independent_void_tasks(kTasksPerBatch, counter);
+    for (auto& task : level0) {
+        task.set_callable([]() {
+            return 1;
+        });
+        all_tasks.emplace_back(&task);
+    }
+    for (size_t i = 0; i < kLevel1Count; ++i) {
+        level1[i].set_callable([](int val) {
+            return val + 1;
+        });
+        level1[i].add_inward_edge<int>(level0[i % kLevel0Count].get_outward_edge());
+        all_tasks.emplace_back(&level1[i]);
+    }
+    for (size_t i = 0; i < kLevel2Count; ++i) {
+        level2[i].set_callable([](int val) {
+            return val + 1;
+        });
+        level2[i].add_inward_edge<int>(level1[i % kLevel1Count].get_outward_edge());
+        all_tasks.emplace_back(&level2[i]);
+    }
 
-        ThreadPoolExecutor executor;
-        for (auto& task : tasks) {
-            executor.add_task(&task);
+    auto all_complete = [&all_tasks]() {
+        return std::all_of(all_tasks.begin(), all_tasks.end(), [](const ITask* task) {
+            return task->get_state() == TaskState::Complete;
+        });
+    };
+
+    // Rebuild every iteration
+    bool rebuild_ok = true;
+    auto rebuild_start = Clock::now();
+    for (size_t iteration = 0; iteration < kIterations; ++iteration) {
+        for (auto* task : all_tasks) {
+            task->reset();
+        }
+        ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+        for (auto* task : all_tasks) {
+            executor.add_task(task);
         }
-
         executor.run();
         executor.wait();
+        rebuild_ok = rebuild_ok && all_complete();
     }
+    auto rebuild_end = Clock::now();
 
-    auto end = Clock::now();
+    // Compile once, reset and re-run
+    bool compiled_ok = true;
+    CompiledGraph graph{all_tasks};
+    ThreadPoolExecutor executor;
+    auto compiled_start = Clock::now();
+    for (size_t iteration = 0; iteration < kIterations; ++iteration) {
+        executor.run(graph);
+        executor.wait();
+        compiled_ok = compiled_ok && all_complete();
+    }
+    auto compiled_end = Clock::now();
 
     // Validate
-    EXPECT_EQ(counter.load(), kTotalCount)
-        << "Not all tasks executed. Expected: " << kTotalCount << ", Got: " << counter.load();
+    EXPECT_TRUE(rebuild_ok) << "Some tasks did not complete when rebuilding the executor";
+    EXPECT_TRUE(compiled_ok) << "Some tasks did not complete when re-running the compiled graph";
+    EXPECT_EQ(level2.back().get_result(), 3);
 
     // Report
-    auto duration = std::chrono::duration_cast<Duration>(end - start);
-    TimingResult result{
-        .total = duration,
-        .min_task = DurationMicro{0},
-        .max_task = DurationMicro{0},
-        .avg_task_ms = duration.count() / static_cast<double>(kTotalCount),
-        .tasks_per_second = kTotalCount * 1000.0 / duration.count()};
-    print_timing_result("Executor_RepeatedUse", result);
+    auto rebuild_us = std::chrono::duration_cast<DurationMicro>(rebuild_end - rebuild_start);
+    auto compiled_us = std::chrono::duration_cast<DurationMicro>(compiled_end - compiled_start);
+    std::cout << "=== Executor_RepeatedUse (" << kTotalTasks << " tasks x " << kIterations << " iterations) ===\n";
+    std::cout << "  Rebuild per iteration:  " << rebuild_us.count() / static_cast<double>(kIterations) << " μs\n";
+    std::cout << "  Compiled per iteration: " << compiled_us.count() / static_cast<double>(kIterations) << " μs\n";
+    std::cout << "  Speedup:                "
+              << rebuild_us.count() / static_cast<double>(std::max<int64_t>(compiled_us.count(), 1)) << "x\n";
 }
 
 // ============================================================================
@@ -498,4 +614,134 @@ TEST(StressPooledExecutor, Executor_ComplexDAG_2K)
     print_timing_result("Executor_ComplexDAG_2K", result);
 }
 
+// ============================================================================
+// Executor Dynamic Work Tests
+// ============================================================================
+
+/**
+ * @brief Stress test: Fan-out of 10,000 children decided at runtime
+ *
+ * Pattern: a parent task computes its fan-out, spawns one child per partition
+ * into a TaskGroup and joins before producing its result. A consumer task
+ * depends on the parent, so the join must complete before the edge is set.
+ */
+TEST(StressPooledExecutor, Executor_DynamicFanOut_10K)
+{
+    constexpr size_t kChildCount = kTaskCount_Heavy; // 10000
+
+    // Setup
+    std::vector<int> partial(kChildCount);
+    Task<int> parent;
+    parent.set_callable([&partial]() -> int {
+        TaskGroup group;
+        for (size_t i = 0; i < partial.size(); ++i) {
+            group.spawn([&partial, i]() {
+                partial[i] = static_cast<int>(i % 7);
+            });
+        }
+        group.join();
+        int sum = 0;
+        for (int value : partial) {
+            sum += value;
+        }
+        return sum;
+    });
+    Task<int, int> consumer;
+    consumer.set_callable([](int sum) -> int {
+        return sum;
+    });
+    consumer.add_inward_edge<int>(parent.get_outward_edge());
+
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+    executor.add_task(&parent);
+    executor.add_task(&consumer);
+
+    // Execute
+    auto start = Clock::now();
+    executor.run();
+    executor.wait();
+    auto end = Clock::now();
+
+    // Validate
+    int expected = 0;
+    for (size_t i = 0; i < kChildCount; ++i) {
+        expected += static_cast<int>(i % 7);
+    }
+    EXPECT_EQ(consumer.get_result(), expected);
+
+    // Report
+    auto duration = std::chrono::duration_cast<Duration>(end - start);
+    TimingResult result{
+        .total = duration,
+        .min_task = DurationMicro{0},
+        .max_task = DurationMicro{0},
+        .avg_task_ms = duration.count() / static_cast<double>(kChildCount),
+        .tasks_per_second = kChildCount * 1000.0 / std::max<int64_t>(duration.count(), 1)};
+    print_timing_result("Executor_DynamicFanOut_10K", result);
+}
+
+// ============================================================================
+// Executor Tracing Tests
+// ============================================================================
+
+/**
+ * @brief Stress test: Overhead of tracing a 2,000-task DAG
+ *
+ * Pattern: 40 chains of 50 tasks, each link also depending on the previous
+ * chain, run with and without a Tracer. Reports both wall times and the time
+ * to export the Chrome trace.
+ */
+TEST(StressPooledExecutor, Executor_Tracing_2K)
+{
+    constexpr size_t kChainCount = 40;
+    constexpr size_t kChainLength = 50;
+
+    auto measure = [&](Tracer* tracer) {
+        std::atomic<size_t> counter{0};
+        std::vector<Task<void, void, void>> tasks(kChainCount * kChainLength);
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            tasks[i].set_callable([&counter]() {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            });
+            if (i % kChainLength != 0) {
+                tasks[i].add_inward_edge<0>(tasks[i - 1].get_outward_edge());
+            }
+            if (i >= kChainLength) {
+                tasks[i].add_inward_edge<1>(tasks[i - kChainLength].get_outward_edge());
+            }
+        }
+
+        ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+        executor.set_tracer(tracer);
+        for (auto& task : tasks) {
+            executor.add_task(&task);
+        }
+        auto start = Clock::now();
+        executor.run();
+        executor.wait();
+        auto end = Clock::now();
+
+        EXPECT_EQ(counter.load(), tasks.size());
+        auto export_time = DurationMicro{0};
+        if (tracer != nullptr) {
+            EXPECT_EQ(tracer->get_events().size(), tasks.size());
+            std::ostringstream out;
+            auto export_start = Clock::now();
+            tracer->write_chrome_trace(out);
+            export_time = std::chrono::duration_cast<DurationMicro>(Clock::now() - export_start);
+        }
+        return std::make_pair(std::chrono::duration_cast<DurationMicro>(end - start), export_time);
+    };
+
+    Tracer tracer;
+    const auto [plain_time, unused] = measure(nullptr);
+    const auto [traced_time, export_time] = measure(&tracer);
+
+    // Report
+    std::cout << "=== Executor_Tracing_2K (" << kChainCount << " chains of " << kChainLength << ") ===\n";
+    std::cout << "  Untraced:               " << plain_time.count() << " μs\n";
+    std::cout << "  Traced:                 " << traced_time.count() << " μs\n";
+    std::cout << "  Chrome trace export:    " << export_time.count() << " μs\n";
+}
+
 } // namespace tw::stress
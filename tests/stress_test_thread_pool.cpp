@@ -2,15 +2,25 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "Executor/Future.h"
+#include "Executor/Parallel.h"
+#include "Executor/Pipeline.h"
 #include "Executor/ThreadPool.h"
+#include "Executor/WorkStealingThreadPool.h"
 #include "stress_test_utils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <iostream>
 #include <random>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -140,6 +150,56 @@ TEST(StressThreadPool, Pool_100K_Tasks)
     print_timing_result("Pool_100K_Tasks", result);
 }
 
+/**
+ * @brief Stress test: Pool_100K_Tasks with and without metrics collection
+ *
+ * Reports both wall times, the overhead of collect_metrics, and the p50/p99
+ * queue latency and busy share the metrics observed.
+ */
+TEST(StressThreadPool, Pool_100K_Tasks_Metrics)
+{
+    constexpr size_t kTaskCount = kTaskCount_Ultra; // 100000
+    const size_t thread_count = std::thread::hardware_concurrency();
+
+    auto measure = [&](bool collect_metrics) {
+        std::atomic<size_t> counter{0};
+        ThreadPool pool(ThreadPoolOptions{.min_threads = thread_count,
+                                          .max_threads = thread_count,
+                                          .idle_timeout = std::chrono::milliseconds::zero(),
+                                          .grow_on_blocking = false,
+                                          .collect_metrics = collect_metrics});
+        for (size_t i = 0; i < kTaskCount; ++i) {
+            pool.add_task([&counter]() {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        auto start = Clock::now();
+        pool.run();
+        pool.wait();
+        auto end = Clock::now();
+
+        EXPECT_EQ(counter.load(), kTaskCount);
+        return std::make_pair(std::chrono::duration_cast<DurationMicro>(end - start), pool.get_metrics());
+    };
+
+    const auto [plain_time, unused] = measure(false);
+    const auto [metered_time, metrics] = measure(true);
+    const auto total = metrics.total();
+    EXPECT_EQ(total.tasks_executed, kTaskCount);
+
+    // Report
+    const double overhead = 100.0 * (static_cast<double>(metered_time.count()) / plain_time.count() - 1.0);
+    const double busy_share = 100.0 * total.busy_ns / std::max<uint64_t>(total.busy_ns + total.idle_ns, 1);
+    std::cout << "=== Pool_100K_Tasks_Metrics (" << thread_count << " workers) ===\n";
+    std::cout << "  Without metrics:        " << plain_time.count() << " μs\n";
+    std::cout << "  With metrics:           " << metered_time.count() << " μs (" << std::fixed
+              << std::setprecision(1) << overhead << "%)\n";
+    std::cout << "  Queue latency p50/p99:  " << total.queue_latency_ns.percentile(0.5) << " / "
+              << total.queue_latency_ns.percentile(0.99) << " ns (bucket bound)\n";
+    std::cout << "  Busy share:             " << busy_share << "%\n";
+    std::cout << std::defaultfloat;
+}
+
 // ============================================================================
 // Long-Running Task Tests
 // ============================================================================
@@ -298,6 +358,63 @@ TEST(StressThreadPool, Pool_ThreadScaling_10K)
         << "16 threads should be significantly faster than 1 thread";
 }
 
+/**
+ * @brief Stress test: WorkStealingThreadPool with different thread counts
+ *
+ * Same workload shape as Pool_ThreadScaling_10K (at a lower task count), but
+ * every worker owns its queue and steals when idle.
+ */
+TEST(StressThreadPool, WorkStealingPool_ThreadScaling_2K)
+{
+    constexpr size_t kTaskCount = 2000;
+    constexpr size_t kWorkDurationMs = 1;
+
+    std::vector<size_t> thread_counts = {1, 2, 4, 8, 16};
+    std::vector<Duration> durations;
+    durations.reserve(thread_counts.size());
+
+    for (const size_t thread_count : thread_counts) {
+        std::atomic<size_t> counter{0};
+
+        // Setup
+        WorkStealingThreadPool pool(thread_count);
+
+        for (size_t i = 0; i < kTaskCount; ++i) {
+            pool.add_task([&counter, kWorkDurationMs]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(kWorkDurationMs));
+                counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+
+        // Execute
+        auto start = Clock::now();
+        pool.run();
+        pool.wait();
+        auto end = Clock::now();
+
+        // Validate
+        EXPECT_EQ(counter.load(), kTaskCount) << "Not all tasks executed with " << thread_count << " threads";
+
+        durations.push_back(std::chrono::duration_cast<Duration>(end - start));
+    }
+
+    // Report
+    std::cout << "\n  Work-Stealing Thread Scaling Results:\n";
+    std::cout << "  " << std::string(60, '-') << "\n";
+    std::cout << "  Threads | Total Time (ms) | Tasks/sec\n";
+    std::cout << "  " << std::string(60, '-') << "\n";
+
+    for (size_t i = 0; i < thread_counts.size(); ++i) {
+        const double tasks_per_sec = kTaskCount * 1000.0 / std::max<int64_t>(durations[i].count(), 1);
+        std::cout << "  " << std::setw(7) << thread_counts[i] << " | " << std::setw(15) << durations[i].count() << " | "
+                  << std::setw(10) << static_cast<int>(tasks_per_sec) << "\n";
+    }
+    std::cout << "  " << std::string(60, '-') << "\n";
+
+    EXPECT_LT(durations[4].count(), durations[0].count() * 0.3)
+        << "16 threads should be significantly faster than 1 thread";
+}
+
 // ============================================================================
 // Clear Under Load Tests
 // ============================================================================
@@ -404,6 +521,49 @@ TEST(StressThreadPool, Pool_ConcurrentSubmission_10K)
     print_timing_result("Pool_ConcurrentSubmission_10K", result);
 }
 
+/**
+ * @brief Stress test: Bulk submission versus per-task submission
+ *
+ * Measures the serial submission phase for 50K tiny tasks pushed one at a
+ * time with add_task() against a single add_tasks() batch.
+ */
+TEST(StressThreadPool, Pool_BulkSubmission_50K)
+{
+    constexpr size_t kTaskCount = kTaskCount_Extreme; // 50000
+    std::atomic<size_t> counter{0};
+    auto increment = [&counter]() {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    // Per-task submission into a running pool
+    ThreadPool single_pool(std::thread::hardware_concurrency());
+    single_pool.run();
+    auto single_start = Clock::now();
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        single_pool.add_task(increment);
+    }
+    auto single_end = Clock::now();
+    single_pool.wait();
+
+    // Batched submission into a running pool
+    ThreadPool batch_pool(std::thread::hardware_concurrency());
+    batch_pool.run();
+    std::vector<std::function<void()>> batch(kTaskCount, increment);
+    auto batch_start = Clock::now();
+    batch_pool.add_tasks(batch);
+    auto batch_end = Clock::now();
+    batch_pool.wait();
+
+    // Validate
+    EXPECT_EQ(counter.load(), kTaskCount * 2) << "Not all tasks executed";
+
+    // Report
+    auto single_us = std::chrono::duration_cast<DurationMicro>(single_end - single_start).count();
+    auto batch_us = std::chrono::duration_cast<DurationMicro>(batch_end - batch_start).count();
+    std::cout << "  add_task submission:  " << single_us << " μs\n";
+    std::cout << "  add_tasks submission: " << batch_us << " μs\n";
+}
+
 // ============================================================================
 // Memory and Resource Tests
 // ============================================================================
@@ -487,4 +647,313 @@ TEST(StressThreadPool, Pool_WithCompletionCallback)
     EXPECT_EQ(callback_called.load(), 1) << "Completion callback was not called once";
 }
 
+/**
+ * @brief Stress test: Request tasks submitted behind a bulk backlog, Normal vs High lane
+ *
+ * Pattern: kBulkCount background tasks of kBulkWork each are queued first, then
+ * kRequestCount request tasks. Measures how long a request waits in the queue.
+ */
+TEST(StressThreadPool, Pool_PriorityLanes_Latency)
+{
+    constexpr size_t kBulkCount = 1000;
+    constexpr size_t kRequestCount = 20;
+    constexpr auto kBulkWork = std::chrono::microseconds(100);
+
+    auto measure = [&](TaskPriority bulk_priority, TaskPriority request_priority) {
+        ThreadPool pool(2);
+        pool.run();
+        for (size_t i = 0; i < kBulkCount; ++i) {
+            pool.add_task(bulk_priority, [kBulkWork]() {
+                std::this_thread::sleep_for(kBulkWork);
+            });
+        }
+        std::vector<DurationMicro> waits(kRequestCount);
+        for (size_t i = 0; i < kRequestCount; ++i) {
+            pool.add_task(request_priority, [&waits, i, submitted = Clock::now()]() {
+                waits[i] = std::chrono::duration_cast<DurationMicro>(Clock::now() - submitted);
+            });
+        }
+        pool.wait();
+        DurationMicro worst{0};
+        for (auto wait : waits) {
+            worst = std::max(worst, wait);
+        }
+        return worst;
+    };
+
+    const auto shared_lane = measure(TaskPriority::Normal, TaskPriority::Normal);
+    const auto high_lane = measure(TaskPriority::Background, TaskPriority::High);
+    EXPECT_LT(high_lane, shared_lane);
+
+    // Report
+    std::cout << "=== Pool_PriorityLanes_Latency (" << kRequestCount << " requests behind " << kBulkCount
+              << " bulk tasks) ===\n";
+    std::cout << "  Worst wait, same lane:  " << shared_lane.count() << " μs\n";
+    std::cout << "  Worst wait, High lane:  " << high_lane.count() << " μs\n";
+}
+
+/**
+ * @brief Stress test: latency from add_task() to task start for each idle policy
+ *
+ * Pattern: bursty micro-tasks. One task is submitted at a time and awaited,
+ * with a short gap between submissions, so the workers are idle at every
+ * submission. Park-only workers pay a futex wakeup per task; polling workers
+ * pick the task up from their spin or yield loop.
+ */
+TEST(StressThreadPool, Pool_IdlePolicy_WakeLatency)
+{
+    constexpr size_t kSamples = 2000;
+    constexpr auto kGap = std::chrono::microseconds(20);
+
+    auto measure = [&](IdlePolicy policy) {
+        ThreadPool pool(ThreadPoolOptions{.min_threads = 2,
+                                          .max_threads = 2,
+                                          .idle_timeout = std::chrono::milliseconds::zero(),
+                                          .idle_policy = policy});
+        pool.run();
+        std::vector<DurationMicro> latencies(kSamples);
+        for (size_t i = 0; i < kSamples; ++i) {
+            const auto gap_end = Clock::now() + kGap;
+            while (Clock::now() < gap_end) {
+                std::this_thread::yield();
+            }
+            pool.add_task([&latencies, i, submitted = Clock::now()]() {
+                latencies[i] = std::chrono::duration_cast<DurationMicro>(Clock::now() - submitted);
+            });
+            pool.wait();
+        }
+        std::sort(latencies.begin(), latencies.end());
+        return std::pair{latencies[kSamples / 2], latencies[kSamples * 99 / 100]};
+    };
+
+    const auto park = measure(IdlePolicy{.spin_count = 0, .yield_count = 0});
+    const auto yield = measure(IdlePolicy{.spin_count = 0, .yield_count = 64});
+    const auto spin = measure(IdlePolicy{});
+
+    // Report
+    std::cout << "=== Pool_IdlePolicy_WakeLatency (" << kSamples << " submissions, median / p99) ===\n";
+    std::cout << "  Park only:          " << park.first.count() << " / " << park.second.count() << " μs\n";
+    std::cout << "  Yield then park:    " << yield.first.count() << " / " << yield.second.count() << " μs\n";
+    std::cout << "  Spin, yield, park:  " << spin.first.count() << " / " << spin.second.count() << " μs\n";
+}
+
+/**
+ * @brief Stress test: Futures of kTaskCount_Heavy small tasks, std::async vs packaged_task vs submit()
+ *
+ * Pattern: each task returns a value that the submitting thread collects through a
+ * future. std::async starts a thread per call; std::packaged_task runs on the pool
+ * but pays for std::future's mutex-based shared state; submit() uses the pool and
+ * a recycled, lock-free shared state.
+ */
+TEST(StressThreadPool, Pool_Submit_vs_StdAsync_10K)
+{
+    constexpr size_t kTaskCount = kTaskCount_Heavy; // 10000
+    constexpr uint64_t kExpected = kTaskCount * (kTaskCount - 1);
+    auto work = [](size_t i) -> uint64_t {
+        return i * 2;
+    };
+
+    // std::async
+    auto async_start = Clock::now();
+    std::vector<std::future<uint64_t>> async_futures;
+    async_futures.reserve(kTaskCount);
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        async_futures.push_back(std::async(std::launch::async, work, i));
+    }
+    uint64_t async_sum = 0;
+    for (auto& future : async_futures) {
+        async_sum += future.get();
+    }
+    auto async_end = Clock::now();
+
+    ThreadPool pool(std::thread::hardware_concurrency());
+    pool.run();
+
+    // std::packaged_task on the pool
+    auto packaged_start = Clock::now();
+    std::vector<std::future<uint64_t>> packaged_futures;
+    packaged_futures.reserve(kTaskCount);
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        std::packaged_task<uint64_t()> task([&work, i]() {
+            return work(i);
+        });
+        packaged_futures.push_back(task.get_future());
+        pool.add_task(std::move(task));
+    }
+    uint64_t packaged_sum = 0;
+    for (auto& future : packaged_futures) {
+        packaged_sum += future.get();
+    }
+    auto packaged_end = Clock::now();
+
+    // submit()
+    auto submit_start = Clock::now();
+    std::vector<Future<uint64_t>> futures;
+    futures.reserve(kTaskCount);
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        futures.push_back(submit(pool, work, i));
+    }
+    uint64_t submit_sum = 0;
+    for (auto& future : futures) {
+        submit_sum += future.get();
+    }
+    auto submit_end = Clock::now();
+    pool.wait();
+
+    // Validate
+    EXPECT_EQ(async_sum, kExpected);
+    EXPECT_EQ(packaged_sum, kExpected);
+    EXPECT_EQ(submit_sum, kExpected);
+
+    // Report
+    std::cout << "=== Pool_Submit_vs_StdAsync_10K (" << kTaskCount << " futures) ===\n";
+    std::cout << "  std::async:             "
+              << std::chrono::duration_cast<DurationMicro>(async_end - async_start).count() << " μs\n";
+    std::cout << "  std::packaged_task:     "
+              << std::chrono::duration_cast<DurationMicro>(packaged_end - packaged_start).count() << " μs\n";
+    std::cout << "  submit():               "
+              << std::chrono::duration_cast<DurationMicro>(submit_end - submit_start).count() << " μs\n";
+}
+
+// ============================================================================
+// Parallel Algorithm Tests
+// ============================================================================
+
+/**
+ * @brief Stress test: parallel_for over 10^7 indices, per partitioner and thread count
+ *
+ * Pattern: an index-space loop with a cheap body. The baseline materialises one
+ * Task<void> per chunk of kChunkSize indices and runs them through a
+ * ThreadPoolExecutor; parallel_for runs the same loop without any Task, Node or
+ * per-chunk job.
+ */
+TEST(StressThreadPool, Pool_ParallelFor_10M)
+{
+    constexpr size_t kCount = 10000000;
+    constexpr size_t kChunkSize = 1000;
+
+    std::vector<float> values(kCount);
+    auto body = [&values](size_t i) {
+        values[i] = std::sqrt(static_cast<float>(i));
+    };
+    auto verify = [&values]() {
+        return values[kCount - 1] == std::sqrt(static_cast<float>(kCount - 1)) && values[kCount / 2] != 0.0F;
+    };
+
+    // Baseline: one Task per chunk
+    std::vector<Task<void>> tasks(kCount / kChunkSize);
+    for (size_t chunk = 0; chunk < tasks.size(); ++chunk) {
+        tasks[chunk].set_callable([&body, chunk]() {
+            for (size_t i = chunk * kChunkSize; i < (chunk + 1) * kChunkSize; ++i) {
+                body(i);
+            }
+        });
+    }
+    ThreadPoolExecutor executor;
+    for (auto& task : tasks) {
+        executor.add_task(&task);
+    }
+    auto task_start = Clock::now();
+    executor.run();
+    executor.wait();
+    auto task_end = Clock::now();
+    EXPECT_TRUE(verify());
+
+    const std::pair<Partitioner, const char*> partitioners[] = {
+        {Partitioner::Static, "Static"}, {Partitioner::Guided, "Guided"}, {Partitioner::Adaptive, "Adaptive"}};
+    const std::vector<size_t> thread_counts = {1, 2, 4, 8};
+
+    // Report
+    std::cout << "=== Pool_ParallelFor_10M (" << kCount << " indices) ===\n";
+    std::cout << "  Task per " << kChunkSize << " indices:  "
+              << std::chrono::duration_cast<DurationMicro>(task_end - task_start).count() << " μs\n";
+    std::cout << "  Workers | Static (μs) | Guided (μs) | Adaptive (μs)\n";
+    for (const size_t workers : thread_counts) {
+        WorkStealingThreadPool pool(workers);
+        pool.run();
+        std::cout << "  " << std::setw(7) << workers;
+        for (const auto& [partitioner, name] : partitioners) {
+            std::fill(values.begin(), values.end(), 0.0F);
+            auto start = Clock::now();
+            parallel_for(pool, size_t{0}, kCount, body, ParallelOptions{.partitioner = partitioner});
+            auto end = Clock::now();
+            EXPECT_TRUE(verify()) << name << " with " << workers << " workers";
+            std::cout << " | " << std::setw(11) << std::chrono::duration_cast<DurationMicro>(end - start).count();
+        }
+        std::cout << "\n";
+        pool.wait();
+    }
+}
+
+/**
+ * @brief Stress test: Log processing pipeline, sequential vs parallel_pipeline
+ *
+ * Pattern: read -> parse -> write over kLineCount synthetic log lines. Reading and
+ * writing are serial and in order; parsing (the expensive step) is parallel. At
+ * most kMaxTokens lines are in flight.
+ */
+TEST(StressThreadPool, Pool_Pipeline_LogProcessing_10K)
+{
+    constexpr size_t kLineCount = kTaskCount_Heavy; // 10000
+    constexpr size_t kMaxTokens = 16;
+
+    auto read_line = [](size_t index) {
+        return "2026-01-01T00:00:00 worker-" + std::to_string(index % 64) + " request " + std::to_string(index);
+    };
+    auto parse = [](const std::string& line) {
+        uint64_t hash = 1469598103934665603ULL;
+        for (int round = 0; round < 50; ++round) {
+            for (char c : line) {
+                hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+            }
+        }
+        return hash;
+    };
+
+    // Sequential
+    uint64_t sequential_digest = 0;
+    auto sequential_start = Clock::now();
+    for (size_t i = 0; i < kLineCount; ++i) {
+        sequential_digest = sequential_digest * 31 + parse(read_line(i));
+    }
+    auto sequential_end = Clock::now();
+
+    // Pipelined
+    WorkStealingThreadPool pool(std::thread::hardware_concurrency());
+    pool.run();
+    size_t next_line = 0;
+    uint64_t pipeline_digest = 0;
+    auto pipeline_start = Clock::now();
+    parallel_pipeline(
+        pool, kMaxTokens,
+        PipelineStage{StageMode::SerialInOrder,
+                      [&](FlowControl& flow) {
+                          if (next_line == kLineCount) {
+                              flow.stop();
+                              return std::string{};
+                          }
+                          return read_line(next_line++);
+                      }},
+        PipelineStage{StageMode::Parallel,
+                      [&parse](std::string line) {
+                          return parse(line);
+                      }},
+        PipelineStage{StageMode::SerialInOrder, [&pipeline_digest](uint64_t hash) {
+                          pipeline_digest = pipeline_digest * 31 + hash;
+                      }});
+    auto pipeline_end = Clock::now();
+    pool.wait();
+
+    // Validate: the write stage saw every line in order
+    EXPECT_EQ(pipeline_digest, sequential_digest);
+
+    // Report
+    std::cout << "=== Pool_Pipeline_LogProcessing_10K (" << kLineCount << " lines, " << kMaxTokens
+              << " tokens) ===\n";
+    std::cout << "  Sequential:             "
+              << std::chrono::duration_cast<DurationMicro>(sequential_end - sequential_start).count() << " μs\n";
+    std::cout << "  Pipelined:              "
+              << std::chrono::duration_cast<DurationMicro>(pipeline_end - pipeline_start).count() << " μs\n";
+}
+
 } // namespace tw::stress
@@ -0,0 +1,248 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/CoTask.h"
+#include "Executor/ThreadPool.h"
+#include "TaskWeave/Task.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+// Test CoTask is lazy and returns its value when started inline
+TEST(CoTaskTest, StartInline)
+{
+    bool entered = false;
+    auto body = [&entered]() -> CoTask<int> {
+        entered = true;
+        co_return 42;
+    };
+
+    CoTask<int> co_task = body();
+    EXPECT_FALSE(entered);
+    co_task.start();
+    co_task.wait();
+
+    EXPECT_TRUE(entered);
+    EXPECT_TRUE(co_task.is_done());
+    EXPECT_EQ(co_task.get_result(), 42);
+}
+
+// Test awaiting an edge suspends without holding the only worker
+TEST(CoTaskTest, AwaitTaskDoesNotBlockWorker)
+{
+    ThreadPool pool(1);
+    Task<int> producer;
+    producer.set_callable([]() -> int {
+        return 20;
+    });
+
+    auto consumer = [](const Task<int>& task) -> CoTask<int> {
+        const int& value = co_await task;
+        co_return value + 1;
+    };
+
+    CoTask<int> co_task = consumer(producer);
+    co_task.start(pool);
+    // Queued behind the coroutine on the single worker: a blocking wait would deadlock
+    pool.add_task([&producer]() {
+        producer.run();
+    });
+    pool.run();
+    co_task.wait();
+
+    EXPECT_EQ(co_task.get_result(), 21);
+    pool.wait();
+}
+
+// Test awaiting an edge that is set from another thread resumes on the pool
+TEST(CoTaskTest, AwaitEdgeResumesOnPool)
+{
+    ThreadPool pool(2);
+    pool.run();
+    Task<void> signal;
+    signal.set_callable([]() {
+    });
+    std::atomic<std::thread::id> resumed_on{};
+
+    auto body = [&resumed_on](const Edge<void>& edge) -> CoTask<> {
+        co_await edge;
+        resumed_on = std::this_thread::get_id();
+    };
+
+    CoTask<> co_task = body(*signal.get_outward_edge());
+    co_task.start(pool);
+    std::thread external([&signal]() {
+        signal.run();
+    });
+    external.join();
+    co_task.wait();
+
+    EXPECT_NE(resumed_on.load(), std::thread::id{});
+    EXPECT_NE(resumed_on.load(), std::this_thread::get_id());
+    pool.wait();
+}
+
+// Test co_await schedule() moves a coroutine onto the pool
+TEST(CoTaskTest, ScheduleOnPool)
+{
+    ThreadPool pool(1);
+    pool.run();
+    std::thread::id before;
+    std::thread::id after;
+
+    auto body = [&](IThreadPool& target) -> CoTask<> {
+        before = std::this_thread::get_id();
+        co_await schedule(target);
+        after = std::this_thread::get_id();
+    };
+
+    CoTask<> co_task = body(pool);
+    co_task.start();
+    co_task.wait();
+
+    EXPECT_EQ(before, std::this_thread::get_id());
+    EXPECT_NE(after, std::this_thread::get_id());
+    pool.wait();
+}
+
+// Test awaiting a child CoTask moves its result without copying
+TEST(CoTaskTest, AwaitChildCoTask)
+{
+    ThreadPool pool(2);
+    pool.run();
+    const int* child_storage = nullptr;
+    const int* parent_storage = nullptr;
+
+    auto child = [&child_storage](int size) -> CoTask<std::vector<int>> {
+        std::vector<int> payload(size, 1);
+        child_storage = payload.data();
+        co_return std::move(payload);
+    };
+    auto parent = [&child, &parent_storage]() -> CoTask<size_t> {
+        std::vector<int> payload = co_await child(1000);
+        parent_storage = payload.data();
+        co_return payload.size();
+    };
+
+    CoTask<size_t> co_task = parent();
+    co_task.start(pool);
+    co_task.wait();
+
+    EXPECT_EQ(co_task.get_result(), 1000);
+    EXPECT_NE(child_storage, nullptr);
+    EXPECT_EQ(parent_storage, child_storage);
+    pool.wait();
+}
+
+// Test an exception escaping the coroutine is rethrown to the reader and to a parent
+TEST(CoTaskTest, ExceptionPropagates)
+{
+    auto failing = []() -> CoTask<int> {
+        throw std::runtime_error("failed");
+        co_return 0;
+    };
+    auto parent = [&failing]() -> CoTask<bool> {
+        try {
+            co_await failing();
+        }
+        catch (const std::runtime_error&) {
+            co_return true;
+        }
+        co_return false;
+    };
+
+    CoTask<int> direct = failing();
+    direct.start();
+    direct.wait();
+    EXPECT_THROW(direct.get_result(), std::runtime_error);
+
+    CoTask<bool> caught = parent();
+    caught.start();
+    caught.wait();
+    EXPECT_TRUE(caught.get_result());
+}
+
+// Test graph tasks consume a coroutine's outward edge
+TEST(CoTaskTest, TaskConsumesCoTaskEdge)
+{
+    auto body = []() -> CoTask<int> {
+        co_return 5;
+    };
+    CoTask<int> co_task = body();
+
+    Task<int, int> consumer;
+    consumer.set_callable([](int value) -> int {
+        return value * 3;
+    });
+    consumer.add_inward_edge<int>(co_task.get_outward_edge());
+
+    co_task.start();
+    consumer.run();
+
+    EXPECT_EQ(consumer.get_result(), 15);
+    EXPECT_EQ(co_task.get_result(), 5);
+}
+
+// Test a graph task consuming the edge of a throwing coroutine fails with the same exception
+TEST(CoTaskTest, TaskConsumesFailedCoTaskEdge)
+{
+    auto body = []() -> CoTask<int> {
+        throw std::runtime_error("failed");
+        co_return 0;
+    };
+    CoTask<int> co_task = body();
+
+    bool called = false;
+    Task<int, int> consumer;
+    consumer.set_callable([&called](int value) -> int {
+        called = true;
+        return value;
+    });
+    consumer.add_inward_edge<int>(co_task.get_outward_edge());
+
+    co_task.start();
+    consumer.run();
+
+    EXPECT_TRUE(co_task.get_outward_edge()->has_failed());
+    EXPECT_FALSE(called);
+    EXPECT_EQ(consumer.get_state(), TaskState::Failed);
+    EXPECT_THROW(std::rethrow_exception(consumer.get_exception()), std::runtime_error);
+}
+
+// Test awaiting a failed or cancelled task rethrows its exception in the coroutine
+TEST(CoTaskTest, AwaitFailedTaskRethrows)
+{
+    Task<int> failing;
+    failing.set_callable([]() -> int {
+        throw std::runtime_error("failed");
+    });
+    Task<int> cancelled;
+    cancelled.set_callable([]() -> int {
+        return 1;
+    });
+
+    auto consumer = [](const Task<int>& task) -> CoTask<int> {
+        const int& value = co_await task;
+        co_return value;
+    };
+
+    CoTask<int> awaits_failing = consumer(failing);
+    awaits_failing.start();
+    failing.run();
+    awaits_failing.wait();
+    EXPECT_THROW(awaits_failing.get_result(), std::runtime_error);
+
+    CoTask<int> awaits_cancelled = consumer(cancelled);
+    awaits_cancelled.start();
+    cancelled.cancel();
+    awaits_cancelled.wait();
+    EXPECT_THROW(awaits_cancelled.get_result(), TaskCancelled);
+}
+
+} // namespace tw::test
@@ -5,7 +5,14 @@
 #include "TaskWeave/Edge.h"
 #include "TaskWeave/Node.h"
 
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace tw::test {
 
@@ -35,6 +42,61 @@ TEST(EdgeTest, SetDataOverwrites)
     EXPECT_EQ(edge.get_data(), 200);
 }
 
+// Test Edge move-in and zero-copy access
+TEST(EdgeTest, MoveInAndReferenceAccess)
+{
+    Node<std::vector<int>> node;
+    Edge<std::vector<int>> edge(&node);
+
+    std::vector<int> data{1, 2, 3, 4};
+    const int* storage = data.data();
+    edge.set_data(std::move(data));
+
+    EXPECT_EQ(edge.get_data_ref().data(), storage);
+    auto span = edge.get_data_span();
+    ASSERT_EQ(span.size(), 4);
+    EXPECT_EQ(span.data(), storage);
+    EXPECT_EQ(span[3], 4);
+}
+
+// Test Edge copies to every consumer in Copy mode
+TEST(EdgeTest, TakeDataCopyMode)
+{
+    Node<std::string> node;
+    Edge<std::string> edge(&node);
+    edge.add_consumer();
+    edge.add_consumer();
+    EXPECT_EQ(edge.get_consumer_count(), 2);
+
+    edge.set_data(std::string(64, 'x'));
+    EXPECT_EQ(edge.take_data(), std::string(64, 'x'));
+    EXPECT_EQ(edge.take_data(), std::string(64, 'x'));
+    EXPECT_EQ(edge.get_data_ref(), std::string(64, 'x'));
+}
+
+// Test Edge moves the data out for the last consumer only
+TEST(EdgeTest, TakeDataMoveToLastConsumer)
+{
+    Node<std::vector<int>> node;
+    Edge<std::vector<int>> edge(&node);
+    edge.set_transfer_mode(EdgeTransferMode::MoveToLastConsumer);
+    edge.add_consumer();
+    edge.add_consumer();
+
+    for (int round = 0; round < 2; round++) {
+        edge.set_data(std::vector<int>(100, round));
+        const int* storage = edge.get_data_ref().data();
+
+        auto first = edge.take_data();
+        EXPECT_NE(first.data(), storage);
+        EXPECT_EQ(first.size(), 100);
+
+        auto last = edge.take_data();
+        EXPECT_EQ(last.data(), storage);
+        EXPECT_EQ(last.size(), 100);
+    }
+}
+
 TEST(EdgeTest, GetOwner)
 {
     Node<int> node;
@@ -63,6 +125,102 @@ TEST(EdgeTest, WaitUntilRetrievable)
     setter.join();
 }
 
+// Test Edge wakes every waiter, including ones arriving after the data is set
+TEST(EdgeTest, WaitUntilRetrievableManyWaiters)
+{
+    Node<void> node;
+    Edge<void> edge(&node);
+
+    constexpr int kWaiters = 8;
+    std::atomic<int> woken{0};
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < kWaiters; i++) {
+        waiters.emplace_back([&edge, &woken]() {
+            edge.wait_until_retrievable();
+            woken.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    edge.set_data();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    edge.wait_until_retrievable();
+
+    EXPECT_EQ(woken.load(), kWaiters);
+}
+
+// Test IEdge stays compact (no mutex, condition variable or string per edge)
+TEST(EdgeTest, CompactSignal)
+{
+    // Owner, flag with waiter count, coroutine waiter list
+    EXPECT_LE(sizeof(IEdge), 3 * sizeof(void*));
+}
+
+// Test a stop-aware wait returns early on a stop request, and true once the data is set
+TEST(EdgeTest, WaitUntilRetrievableStopToken)
+{
+    Node<int> node;
+    Edge<int> edge(&node);
+
+    std::stop_source source;
+    std::atomic<bool> result{true};
+    std::thread waiter([&edge, &result, token = source.get_token()]() {
+        result = edge.wait_until_retrievable(token);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    source.request_stop();
+    waiter.join();
+    EXPECT_FALSE(result.load());
+    EXPECT_FALSE(edge.is_retrievable());
+
+    std::stop_source unused;
+    std::thread setter([&edge]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        edge.set_data(1);
+    });
+    EXPECT_TRUE(edge.wait_until_retrievable(unused.get_token()));
+    setter.join();
+}
+
+// Test registered EdgeWaiters are called back once the data is set
+TEST(EdgeTest, AddWaiterCallback)
+{
+    struct CountingWaiter : EdgeWaiter {
+        int calls = 0;
+    };
+    auto on_ready = [](EdgeWaiter* waiter) {
+        static_cast<CountingWaiter*>(waiter)->calls++;
+    };
+
+    Node<int> node;
+    Edge<int> edge(&node);
+    CountingWaiter first;
+    CountingWaiter second;
+    first.on_ready = on_ready;
+    second.on_ready = on_ready;
+    EXPECT_TRUE(edge.add_waiter(&first));
+    EXPECT_TRUE(edge.add_waiter(&second));
+
+    edge.set_data(3);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(second.calls, 1);
+
+    // Already retrievable: not registered, and setting again calls nobody
+    CountingWaiter late;
+    late.on_ready = on_ready;
+    EXPECT_FALSE(edge.add_waiter(&late));
+    edge.set_data(4);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(late.calls, 0);
+
+    edge.reset();
+    EXPECT_TRUE(edge.add_waiter(&late));
+    edge.set_data(5);
+    EXPECT_EQ(late.calls, 1);
+}
+
 // Test Edge<void> specialization
 TEST(EdgeVoidTest, SetData)
 {
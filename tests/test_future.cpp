@@ -0,0 +1,177 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/Future.h"
+#include "Executor/ThreadPool.h"
+#include "Executor/WorkStealingThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+// Test submit() returns values, move-only results and void
+TEST(FutureTest, SubmitAndGet)
+{
+    ThreadPool pool(2);
+    pool.run();
+
+    Future<int> sum = submit(pool, [](int a, int b) { return a + b; }, 20, 22);
+    Future<std::unique_ptr<std::string>> text = submit(pool, []() {
+        return std::make_unique<std::string>("weave");
+    });
+    std::atomic<bool> ran{false};
+    Future<void> done = submit(pool, TaskPriority::High, [&ran]() { ran = true; });
+
+    EXPECT_EQ(sum.get(), 42);
+    EXPECT_FALSE(sum.valid());
+    EXPECT_EQ(*text.get(), "weave");
+    done.get();
+    EXPECT_TRUE(ran.load());
+    pool.wait();
+}
+
+// Test an exception thrown by the task is rethrown by get()
+TEST(FutureTest, ExceptionRethrown)
+{
+    WorkStealingThreadPool pool(2);
+    pool.run();
+
+    Future<int> future = submit(pool, []() -> int { throw std::runtime_error("failed"); });
+    future.wait();
+    EXPECT_TRUE(future.is_ready());
+    EXPECT_THROW(future.get(), std::runtime_error);
+    pool.wait();
+}
+
+// Test then() chains continuations and skips them when an earlier step threw
+TEST(FutureTest, ThenChaining)
+{
+    WorkStealingThreadPool pool(4);
+    pool.run();
+
+    Future<std::string> chained = submit(pool, []() { return 6; })
+                                      .then([](int value) { return value * 7; })
+                                      .then([](int value) { return std::to_string(value); });
+    EXPECT_EQ(chained.get(), "42");
+
+    std::atomic<bool> continuation_ran{false};
+    Future<void> failed = submit(pool, []() -> int { throw std::runtime_error("failed"); })
+                              .then([&continuation_ran](int) { continuation_ran = true; });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    EXPECT_FALSE(continuation_ran.load());
+
+    // A continuation attached to a ready future is submitted right away
+    Future<int> ready = submit(pool, []() { return 1; });
+    ready.wait();
+    EXPECT_EQ(std::move(ready).then(pool, [](int value) { return value + 1; }).get(), 2);
+    pool.wait();
+}
+
+// Test when_all() collects values in input order and forwards the first exception
+TEST(FutureTest, WhenAll)
+{
+    WorkStealingThreadPool pool(4);
+    pool.run();
+
+    std::vector<Future<int>> futures;
+    for (int i = 0; i < 100; i++) {
+        futures.push_back(submit(pool, [i]() {
+            if (i % 10 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            return i * i;
+        }));
+    }
+    std::vector<int> values = when_all(std::move(futures)).get();
+    ASSERT_EQ(values.size(), 100);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(values[i], i * i);
+    }
+
+    std::vector<Future<void>> with_error;
+    with_error.push_back(submit(pool, []() {}));
+    with_error.push_back(submit(pool, []() { throw std::logic_error("second"); }));
+    EXPECT_THROW(when_all(std::move(with_error)).get(), std::logic_error);
+
+    EXPECT_TRUE(when_all(std::vector<Future<int>>{}).get().empty());
+    pool.wait();
+}
+
+// Test when_any() reports the first ready future and hands back all of them
+TEST(FutureTest, WhenAny)
+{
+    ThreadPool pool(2);
+    pool.run();
+
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    std::vector<Future<int>> futures;
+    futures.push_back(submit(pool, [gate]() {
+        gate.wait();
+        return 1;
+    }));
+    futures.push_back(submit(pool, []() { return 2; }));
+
+    WhenAnyResult<int> first = when_any(std::move(futures)).get();
+    EXPECT_EQ(first.index, 1);
+    ASSERT_EQ(first.futures.size(), 2);
+    EXPECT_EQ(first.futures[1].get(), 2);
+    release.set_value();
+    EXPECT_EQ(first.futures[0].get(), 1);
+
+    EXPECT_EQ(when_any(std::vector<Future<int>>{}).get().index, SIZE_MAX);
+    pool.wait();
+}
+
+// Test a job dropped from the queue breaks its future's promise
+TEST(FutureTest, BrokenPromise)
+{
+    ThreadPool pool(1);
+    Future<int> future = submit(pool, []() { return 1; });
+    pool.clear_queued_tasks();
+
+    try {
+        future.get();
+        FAIL() << "expected std::future_error";
+    }
+    catch (const std::future_error& error) {
+        EXPECT_EQ(error.code(), std::future_errc::broken_promise);
+    }
+
+    // A continuation is submitted to the pool while the cleared job is destroyed
+    std::atomic<bool> release{false};
+    pool.run();
+    pool.add_task([&release]() {
+        while (!release.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    });
+    bool continuation_ran = false;
+    Future<int> chained = submit(pool, []() { return 1; }).then([&continuation_ran](int value) {
+        continuation_ran = true;
+        return value + 1;
+    });
+    pool.clear_queued_tasks();
+    release.store(true, std::memory_order_release);
+
+    try {
+        chained.get();
+        FAIL() << "expected std::future_error";
+    }
+    catch (const std::future_error& error) {
+        EXPECT_EQ(error.code(), std::future_errc::broken_promise);
+    }
+    EXPECT_FALSE(continuation_ran);
+    pool.wait();
+}
+
+} // namespace tw::test
@@ -0,0 +1,124 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "TaskWeave/GraphSnapshot.h"
+#include "TaskWeave/Helper.h"
+#include "TaskWeave/Task.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace tw::test {
+
+// Test GraphSnapshot builds CSR adjacency and Kahn levels for a diamond
+TEST(GraphSnapshotTest, DiamondLevels)
+{
+    Task<int> top;
+    Task<int, int> left;
+    Task<int, int> right;
+    Task<int, int, int> bottom;
+    left.add_inward_edge<int>(top.get_outward_edge());
+    right.add_inward_edge<int>(top.get_outward_edge());
+    bottom.add_inward_edge<0>(left.get_outward_edge());
+    bottom.add_inward_edge<1>(right.get_outward_edge());
+
+    std::vector<INode*> nodes{bottom.as_node(), right.as_node(), left.as_node(), top.as_node()};
+    GraphSnapshot snapshot{nodes};
+
+    ASSERT_EQ(snapshot.size(), 4);
+    EXPECT_TRUE(snapshot.compute_levels());
+
+    const size_t top_index = snapshot.find(top.as_node());
+    const size_t bottom_index = snapshot.find(bottom.as_node());
+    EXPECT_EQ(snapshot.get_successors(top_index).size(), 2);
+    EXPECT_EQ(snapshot.get_predecessors(bottom_index).size(), 2);
+    EXPECT_EQ(snapshot.get_level(top_index), 0);
+    EXPECT_EQ(snapshot.get_level(snapshot.find(left.as_node())), 1);
+    EXPECT_EQ(snapshot.get_level(snapshot.find(right.as_node())), 1);
+    EXPECT_EQ(snapshot.get_level(bottom_index), 2);
+}
+
+// Test GraphSnapshot discovers predecessors that were not passed in
+TEST(GraphSnapshotTest, DiscoversPredecessors)
+{
+    Task<int> producer;
+    Task<int, int> middle;
+    Task<int, int> consumer;
+    middle.add_inward_edge<int>(producer.get_outward_edge());
+    consumer.add_inward_edge<int>(middle.get_outward_edge());
+
+    std::vector<INode*> nodes{consumer.as_node()};
+    GraphSnapshot snapshot{nodes};
+
+    EXPECT_EQ(snapshot.size(), 3);
+    EXPECT_LT(snapshot.find(producer.as_node()), snapshot.size());
+    EXPECT_EQ(snapshot.find(nullptr), snapshot.size());
+}
+
+// Test levels match the recursive set_reachability, including empty input slots
+TEST(GraphSnapshotTest, MatchesRecursiveReachability)
+{
+    Task<int> root;
+    Task<int, int, int> partial; // second input left unset
+    Task<int, int> tail;
+    partial.add_inward_edge<0>(root.get_outward_edge());
+    tail.add_inward_edge<int>(partial.get_outward_edge());
+    Task<int, int> unconnected;
+
+    tail.set_reachability();
+    unconnected.set_reachability();
+    const size_t recursive_partial = partial.get_reachability();
+    const size_t recursive_tail = tail.get_reachability();
+    const size_t recursive_unconnected = unconnected.get_reachability();
+
+    partial.assign_reachability(0);
+    tail.assign_reachability(0);
+    unconnected.assign_reachability(0);
+    std::vector<ITask*> tasks{&tail, &unconnected};
+    compute_reachability(tasks);
+
+    EXPECT_EQ(partial.get_reachability(), recursive_partial);
+    EXPECT_EQ(tail.get_reachability(), recursive_tail);
+    EXPECT_EQ(unconnected.get_reachability(), recursive_unconnected);
+}
+
+// Test compute_reachability handles chains far deeper than the recursive version could
+TEST(GraphSnapshotTest, DeepChainIsIterative)
+{
+    constexpr size_t kChainLength = 100000;
+    std::vector<std::unique_ptr<Task<void, void>>> chain;
+    chain.reserve(kChainLength);
+    for (size_t i = 0; i < kChainLength; i++) {
+        chain.push_back(std::make_unique<Task<void, void>>());
+        if (i > 0) {
+            chain[i]->add_inward_edge<0>(chain[i - 1]->get_outward_edge());
+        }
+    }
+
+    std::vector<ITask*> tasks{chain.back().get()};
+    compute_reachability(tasks);
+
+    EXPECT_EQ(chain.front()->get_reachability(), 1);
+    EXPECT_EQ(chain.back()->get_reachability(), kChainLength);
+}
+
+// Test Node::get_inward_edge returns edges by slot without allocating a vector
+TEST(GraphSnapshotTest, GetInwardEdgeBySlot)
+{
+    Task<int> a;
+    Task<double> b;
+    Task<int, int, double> consumer;
+    consumer.add_inward_edge<int>(a.get_outward_edge());
+
+    EXPECT_EQ(consumer.get_inward_edge(0), a.get_outward_edge());
+    EXPECT_EQ(consumer.get_inward_edge(1), nullptr);
+    EXPECT_EQ(consumer.get_inward_edge(2), nullptr);
+
+    consumer.add_inward_edge<double>(b.get_outward_edge());
+    EXPECT_EQ(consumer.get_inward_edge(1), b.get_outward_edge());
+    EXPECT_EQ(a.get_inward_edge(0), nullptr);
+}
+
+} // namespace tw::test
@@ -0,0 +1,220 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/NumaThreadPool.h"
+#include "Executor/ThreadPoolExecutor.h"
+#include "TaskWeave/Task.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+namespace {
+
+/**
+ * @brief Simulated two-node machine with two CPUs per node.
+ */
+auto make_two_node_topology() -> CpuTopology
+{
+    return CpuTopology({CpuInfo{.id = 0, .core_id = 0, .numa_node = 0},
+                        CpuInfo{.id = 1, .core_id = 1, .numa_node = 0},
+                        CpuInfo{.id = 2, .core_id = 2, .numa_node = 1},
+                        CpuInfo{.id = 3, .core_id = 3, .numa_node = 1}});
+}
+
+/**
+ * @brief Options for the simulated machine: its CPUs may not exist here.
+ */
+auto make_local_options() -> NumaPoolOptions
+{
+    return NumaPoolOptions{.threads_per_node = 2, .pin_workers = false, .steal_remote = false};
+}
+
+} // namespace
+
+// Test the pool builds one worker group per node of the topology
+TEST(NumaThreadPoolTest, Construction)
+{
+    NumaThreadPool pool(make_two_node_topology(), NumaPoolOptions{.pin_workers = false});
+
+    EXPECT_EQ(pool.node_count(), 2);
+    EXPECT_EQ(pool.get_node_ids(), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(pool.worker_count(), 4);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_FALSE(NumaThreadPool::current_node().has_value());
+
+    NumaThreadPool detected;
+    EXPECT_GE(detected.node_count(), 1);
+    detected.run();
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 10; i++) {
+        detected.add_task([&counter]() {
+            counter++;
+        });
+    }
+    detected.wait();
+    EXPECT_EQ(counter.load(), 10);
+}
+
+// Test tasks queued on a node run on that node's workers, and tasks they spawn stay there
+TEST(NumaThreadPoolTest, TasksRunOnTheirNode)
+{
+    NumaThreadPool pool(make_two_node_topology(), make_local_options());
+    pool.run();
+
+    std::mutex mtx;
+    std::vector<std::pair<uint32_t, std::optional<uint32_t>>> seen;
+    for (uint32_t i = 0; i < 20; i++) {
+        const uint32_t node = i % 2;
+        pool.add_task_on_node(node, [&pool, &mtx, &seen, node]() {
+            {
+                std::lock_guard lck{mtx};
+                seen.emplace_back(node, NumaThreadPool::current_node());
+            }
+            pool.add_task([&mtx, &seen, node]() {
+                std::lock_guard lck{mtx};
+                seen.emplace_back(node, NumaThreadPool::current_node());
+            });
+        });
+    }
+    pool.wait();
+
+    ASSERT_EQ(seen.size(), 40);
+    for (const auto& [expected, actual] : seen) {
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+// Test an idle node steals from a node whose workers are all busy
+TEST(NumaThreadPoolTest, StealsFromRemoteNode)
+{
+    NumaThreadPool pool(make_two_node_topology(),
+                        NumaPoolOptions{.threads_per_node = 1, .pin_workers = false, .steal_remote = true});
+    pool.run();
+
+    // Node 0's only worker waits for a task queued behind it on node 0
+    std::atomic<bool> released{false};
+    std::atomic<uint32_t> releasing_node{UINT32_MAX};
+    pool.add_task_on_node(0, [&released]() {
+        while (!released.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+    pool.add_task_on_node(0, [&released, &releasing_node]() {
+        releasing_node = NumaThreadPool::current_node().value_or(UINT32_MAX);
+        released.store(true, std::memory_order_release);
+    });
+    pool.wait();
+
+    EXPECT_TRUE(released.load());
+    EXPECT_EQ(releasing_node.load(), 1);
+}
+
+// Test external batches are spread over the nodes
+TEST(NumaThreadPoolTest, AddTasksSpreadsOverNodes)
+{
+    NumaThreadPool pool(make_two_node_topology(), make_local_options());
+    pool.run();
+
+    std::atomic<int> per_node[2] = {0, 0};
+    std::vector<std::function<void()>> batch(10, [&per_node]() {
+        per_node[NumaThreadPool::current_node().value()]++;
+    });
+    EXPECT_EQ(pool.add_tasks(batch), 10);
+    pool.wait();
+
+    EXPECT_EQ(per_node[0].load(), 5);
+    EXPECT_EQ(per_node[1].load(), 5);
+}
+
+// Test clear_queued_tasks drops the tasks of every node
+TEST(NumaThreadPoolTest, ClearQueuedTasks)
+{
+    NumaThreadPool pool(make_two_node_topology(), make_local_options());
+
+    std::atomic<int> counter{0};
+    for (uint32_t i = 0; i < 6; i++) {
+        pool.add_task_on_node(i, [&counter]() {
+            counter++;
+        });
+    }
+    EXPECT_EQ(pool.size(), 6);
+    EXPECT_EQ(pool.active_task_count(), 6);
+
+    pool.clear_queued_tasks();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_TRUE(pool.is_idle());
+
+    pool.run();
+    pool.wait();
+    EXPECT_EQ(counter.load(), 0);
+}
+
+// Test ThreadPoolExecutor queues hinted tasks on their node, in both dispatch modes
+TEST(NumaThreadPoolTest, ExecutorNodeHints)
+{
+    for (auto mode : {DispatchMode::Eager, DispatchMode::DependencyDriven}) {
+        ThreadPoolExecutor executor(std::make_unique<NumaThreadPool>(make_two_node_topology(), make_local_options()),
+                                    ExecutorOptions{.dispatch_mode = mode, .numa_node = 0});
+
+        std::optional<uint32_t> producer_node;
+        std::optional<uint32_t> consumer_node;
+        std::optional<uint32_t> sink_node;
+
+        Task<int> producer;
+        producer.set_numa_node(1);
+        producer.set_callable([&producer_node]() -> int {
+            producer_node = NumaThreadPool::current_node();
+            return 42;
+        });
+        Task<int, int> consumer;
+        consumer.set_numa_node(1);
+        consumer.set_callable([&consumer_node](int value) -> int {
+            consumer_node = NumaThreadPool::current_node();
+            return value + 1;
+        });
+        consumer.add_inward_edge<int>(producer.get_outward_edge());
+        // No hint: falls back to ExecutorOptions::numa_node
+        Task<void, int> sink;
+        sink.set_callable([&sink_node](int) {
+            sink_node = NumaThreadPool::current_node();
+        });
+        sink.add_inward_edge<int>(consumer.get_outward_edge());
+
+        executor.add_task(&producer);
+        executor.add_task(&consumer);
+        executor.add_task(&sink);
+        executor.run();
+        executor.wait();
+
+        EXPECT_EQ(producer_node, 1U);
+        EXPECT_EQ(consumer_node, 1U);
+        EXPECT_EQ(sink_node, 0U);
+    }
+}
+
+// Test NumaAllocator memory is usable, whether or not the node exists here
+TEST(NumaThreadPoolTest, NumaAllocator)
+{
+    for (uint32_t node : {0U, 7U}) {
+        std::vector<int, NumaAllocator<int>> values{NumaAllocator<int>(node)};
+        for (int i = 0; i < 10000; i++) {
+            values.push_back(i);
+        }
+        EXPECT_EQ(values.get_allocator().get_node(), node);
+        EXPECT_EQ(values[9999], 9999);
+    }
+    EXPECT_EQ(NumaAllocator<int>(1), NumaAllocator<double>(1));
+}
+
+} // namespace tw::test
@@ -0,0 +1,193 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/Parallel.h"
+#include "Executor/ThreadPool.h"
+#include "Executor/WorkStealingThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+namespace {
+
+constexpr Partitioner kPartitioners[] = {Partitioner::Static, Partitioner::Guided, Partitioner::Adaptive};
+
+} // namespace
+
+// Test every index is visited exactly once with each partitioner
+TEST(ParallelTest, ForVisitsEachIndexOnce)
+{
+    WorkStealingThreadPool pool(4);
+    pool.run();
+
+    for (auto partitioner : kPartitioners) {
+        std::vector<int> visits(100000, 0);
+        parallel_for(
+            pool, size_t{0}, visits.size(),
+            [&visits](size_t i) {
+                visits[i]++;
+            },
+            ParallelOptions{.partitioner = partitioner});
+
+        for (size_t i = 0; i < visits.size(); i++) {
+            ASSERT_EQ(visits[i], 1) << "index " << i << ", partitioner " << static_cast<int>(partitioner);
+        }
+    }
+    pool.wait();
+}
+
+// Test a chunk body receives contiguous chunks of at least the grain size (except the tail)
+TEST(ParallelTest, ForChunkBodyRespectsGrain)
+{
+    ThreadPool pool(3);
+    pool.run();
+
+    for (auto partitioner : kPartitioners) {
+        std::atomic<int> covered{0};
+        std::atomic<int> short_chunks{0};
+        parallel_for(
+            pool, 10, 1010,
+            [&](int first, int last) {
+                covered += last - first;
+                if (last - first < 64 && last != 1010) {
+                    short_chunks++;
+                }
+            },
+            ParallelOptions{.partitioner = partitioner, .grain_size = 64});
+
+        EXPECT_EQ(covered.load(), 1000);
+        EXPECT_EQ(short_chunks.load(), 0);
+    }
+    pool.wait();
+}
+
+// Test parallel_reduce with element and chunk bodies
+TEST(ParallelTest, ReduceSum)
+{
+    WorkStealingThreadPool pool(4);
+    pool.run();
+    constexpr int64_t kCount = 1000000;
+    constexpr int64_t kExpected = kCount * (kCount - 1) / 2;
+
+    for (auto partitioner : kPartitioners) {
+        const ParallelOptions options{.partitioner = partitioner};
+        const int64_t element_sum = parallel_reduce(
+            pool, int64_t{0}, kCount, int64_t{0},
+            [](int64_t i) {
+                return i;
+            },
+            std::plus<>{}, options);
+        const int64_t chunk_sum = parallel_reduce(
+            pool, int64_t{0}, kCount, int64_t{0},
+            [](int64_t first, int64_t last, int64_t sum) {
+                for (int64_t i = first; i < last; i++) {
+                    sum += i;
+                }
+                return sum;
+            },
+            std::plus<>{}, options);
+
+        EXPECT_EQ(element_sum, kExpected);
+        EXPECT_EQ(chunk_sum, kExpected);
+    }
+    pool.wait();
+}
+
+// Test the range overload and empty ranges
+TEST(ParallelTest, ForRangeAndEmpty)
+{
+    ThreadPool pool(2);
+    pool.run();
+
+    std::vector<int> values(5000, 1);
+    parallel_for(pool, values, [](int& value) {
+        value *= 3;
+    });
+    for (int value : values) {
+        ASSERT_EQ(value, 3);
+    }
+
+    bool called = false;
+    parallel_for(pool, 5, 5, [&called](int) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+    EXPECT_EQ(parallel_reduce(pool, 0, 0, 7, [](int i) { return i; }, std::plus<>{}), 7);
+    pool.wait();
+}
+
+// Test the loop completes from the pool's only worker and on a pool that is not running
+TEST(ParallelTest, CallerRunsRemainingChunks)
+{
+    ThreadPool pool(1);
+    std::atomic<int> nested{0};
+    pool.add_task([&pool, &nested]() {
+        parallel_for(pool, 0, 1000, [&nested](int) {
+            nested++;
+        });
+    });
+    pool.run();
+    pool.wait();
+    EXPECT_EQ(nested.load(), 1000);
+
+    ThreadPool stopped(2);
+    int sum = parallel_reduce(stopped, 0, 100, 0, [](int i) { return i; }, std::plus<>{});
+    EXPECT_EQ(sum, 4950);
+}
+
+// Test an adaptive helper that finds nothing left to split frees its worker before the loop completes
+TEST(ParallelTest, AdaptiveHelperReturnsWithoutSplittableWork)
+{
+    ThreadPool pool(1);
+    std::atomic<bool> worker_free{false};
+    parallel_for(
+        pool, 0, 2,
+        [&pool, &worker_free](int i) {
+            if (i != 0) {
+                return;
+            }
+            // The helper is queued first; the caller already owns the whole range
+            pool.run();
+            pool.add_task([&worker_free]() {
+                worker_free = true;
+            });
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!worker_free.load() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        },
+        ParallelOptions{.partitioner = Partitioner::Adaptive, .grain_size = 1});
+    EXPECT_TRUE(worker_free.load());
+    pool.wait();
+}
+
+// Test the first exception is rethrown to the caller
+TEST(ParallelTest, ExceptionRethrown)
+{
+    WorkStealingThreadPool pool(2);
+    pool.run();
+
+    for (auto partitioner : kPartitioners) {
+        EXPECT_THROW(parallel_for(
+                         pool, 0, 10000,
+                         [](int i) {
+                             if (i == 4321) {
+                                 throw std::runtime_error("failed");
+                             }
+                         },
+                         ParallelOptions{.partitioner = partitioner}),
+                     std::runtime_error);
+    }
+    pool.wait();
+}
+
+} // namespace tw::test
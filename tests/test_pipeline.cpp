@@ -0,0 +1,196 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/Pipeline.h"
+#include "Executor/ThreadPool.h"
+#include "Executor/WorkStealingThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+// Test serial stages see tokens in source order although a parallel stage reorders them
+TEST(PipelineTest, SerialStagesKeepSourceOrder)
+{
+    WorkStealingThreadPool pool(4);
+    pool.run();
+
+    int next = 0;
+    std::vector<int> written;
+    parallel_pipeline(
+        pool, 8,
+        PipelineStage{StageMode::SerialInOrder,
+                      [&next](FlowControl& flow) {
+                          if (next == 500) {
+                              flow.stop();
+                          }
+                          return next++;
+                      }},
+        PipelineStage{StageMode::Parallel,
+                      [](int value) {
+                          if (value % 7 == 0) {
+                              std::this_thread::sleep_for(std::chrono::microseconds(50));
+                          }
+                          return std::to_string(value * 2);
+                      }},
+        PipelineStage{StageMode::SerialInOrder, [&written](std::string text) {
+                          written.push_back(std::stoi(text));
+                      }});
+
+    ASSERT_EQ(written.size(), 500);
+    for (int i = 0; i < 500; i++) {
+        ASSERT_EQ(written[i], i * 2);
+    }
+    pool.wait();
+}
+
+// Test the number of tokens between source and sink never exceeds max_tokens
+TEST(PipelineTest, MaxTokensBoundsInFlight)
+{
+    ThreadPool pool(4);
+    pool.run();
+    constexpr size_t kMaxTokens = 3;
+
+    int next = 0;
+    std::atomic<int> in_flight{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> parallel_now{0};
+    std::atomic<int> parallel_peak{0};
+    parallel_pipeline(
+        pool, kMaxTokens,
+        PipelineStage{StageMode::SerialInOrder,
+                      [&](FlowControl& flow) {
+                          if (next == 60) {
+                              flow.stop();
+                              return 0;
+                          }
+                          const int now = ++in_flight;
+                          peak = std::max(peak.load(), now);
+                          return next++;
+                      }},
+        PipelineStage{StageMode::Parallel,
+                      [&](int value) {
+                          const int now = ++parallel_now;
+                          parallel_peak = std::max(parallel_peak.load(), now);
+                          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                          parallel_now--;
+                          return value;
+                      }},
+        PipelineStage{StageMode::SerialInOrder, [&](int) {
+                          in_flight--;
+                      }});
+
+    EXPECT_EQ(next, 60);
+    EXPECT_LE(peak.load(), static_cast<int>(kMaxTokens));
+    EXPECT_GT(parallel_peak.load(), 1);
+    EXPECT_LE(parallel_peak.load(), static_cast<int>(kMaxTokens));
+    pool.wait();
+}
+
+// Test move-only items and a pipeline run from the pool's only worker
+TEST(PipelineTest, MoveOnlyItemsOnSingleWorker)
+{
+    ThreadPool pool(1);
+    int sum = 0;
+    pool.add_task([&pool, &sum]() {
+        int next = 1;
+        parallel_pipeline(
+            pool, 2,
+            PipelineStage{StageMode::SerialInOrder,
+                          [&next](FlowControl& flow) {
+                              if (next > 10) {
+                                  flow.stop();
+                              }
+                              return std::make_unique<int>(next++);
+                          }},
+            PipelineStage{StageMode::Parallel,
+                          [](std::unique_ptr<int> value) {
+                              *value *= 10;
+                              return value;
+                          }},
+            PipelineStage{StageMode::SerialInOrder, [&sum](std::unique_ptr<int> value) {
+                              sum += *value;
+                          }});
+    });
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(sum, 550);
+}
+
+// Test an exception stops the source and is rethrown after in-flight tokens drain
+TEST(PipelineTest, ExceptionStopsSource)
+{
+    WorkStealingThreadPool pool(2);
+    pool.run();
+
+    int produced = 0;
+    std::atomic<int> consumed{0};
+    auto run = [&]() {
+        parallel_pipeline(
+            pool, 4,
+            PipelineStage{StageMode::SerialInOrder,
+                          [&produced](FlowControl& flow) {
+                              if (produced == 100000) {
+                                  flow.stop();
+                              }
+                              return produced++;
+                          }},
+            PipelineStage{StageMode::Parallel,
+                          [](int value) {
+                              if (value == 20) {
+                                  throw std::runtime_error("bad record");
+                              }
+                              return value;
+                          }},
+            PipelineStage{StageMode::SerialInOrder, [&consumed](int) {
+                              consumed++;
+                          }});
+    };
+
+    EXPECT_THROW(run(), std::runtime_error);
+    EXPECT_LT(produced, 100000);
+    EXPECT_LE(consumed.load(), 20);
+    pool.wait();
+}
+
+// Test a source-only pipeline and one whose source stops immediately
+TEST(PipelineTest, SourceOnlyAndEmptyStream)
+{
+    ThreadPool pool(2);
+    pool.run();
+
+    int calls = 0;
+    parallel_pipeline(pool, 4, PipelineStage{StageMode::SerialInOrder, [&calls](FlowControl& flow) {
+                                                 if (++calls == 5) {
+                                                     flow.stop();
+                                                 }
+                                                 return calls;
+                                             }});
+    EXPECT_EQ(calls, 5);
+
+    bool sink_called = false;
+    parallel_pipeline(
+        pool, 4,
+        PipelineStage{StageMode::SerialInOrder,
+                      [](FlowControl& flow) {
+                          flow.stop();
+                          return 0;
+                      }},
+        PipelineStage{StageMode::SerialInOrder, [&sink_called](int) {
+                          sink_called = true;
+                      }});
+    EXPECT_FALSE(sink_called);
+    pool.wait();
+}
+
+} // namespace tw::test
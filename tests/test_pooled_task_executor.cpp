@@ -7,7 +7,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace tw::test {
 
@@ -170,6 +177,163 @@ TEST(ThreadPoolExecutorTest, Cancel)
     EXPECT_LT(counter, 50);
 }
 
+// Test a failure cancels the tasks that have not started, in both dispatch modes
+TEST(ThreadPoolExecutorTest, CancelOnFailure)
+{
+    for (auto mode : {DispatchMode::Eager, DispatchMode::DependencyDriven}) {
+        ThreadPoolExecutor executor(
+            std::make_unique<ThreadPool>(2), ExecutorOptions{.dispatch_mode = mode, .cancel_on_failure = true});
+
+        // A failing root with a long chain behind it, next to independent work
+        Task<int> root;
+        root.set_callable([]() -> int {
+            throw std::runtime_error("corrupt input");
+        });
+        std::atomic<int> chain_runs{0};
+        std::vector<Task<int, int>> chain(100);
+        for (size_t i = 0; i < chain.size(); i++) {
+            chain[i].set_callable([&chain_runs](int value) {
+                chain_runs++;
+                return value + 1;
+            });
+            chain[i].add_inward_edge<int>(i == 0 ? root.get_outward_edge() : chain[i - 1].get_outward_edge());
+        }
+        // Independent work behind an already completed seed, so the root is dispatched first
+        Task<void> seed;
+        seed.set_callable([]() {});
+        seed.run();
+        std::atomic<int> independent_runs{0};
+        std::vector<Task<void, void>> independent(1000);
+        for (auto& task : independent) {
+            task.set_callable([&independent_runs]() {
+                independent_runs++;
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            });
+            task.add_inward_edge<void>(seed.get_outward_edge());
+        }
+
+        executor.add_task(&root);
+        for (auto& task : chain) {
+            executor.add_task(&task);
+        }
+        for (auto& task : independent) {
+            executor.add_task(&task);
+        }
+        executor.run();
+        executor.wait();
+
+        EXPECT_EQ(executor.get_failed_task(), &root);
+        EXPECT_EQ(root.get_state(), TaskState::Failed);
+        EXPECT_EQ(chain_runs.load(), 0);
+        for (auto& task : chain) {
+            EXPECT_TRUE(task.get_state() == TaskState::Failed || task.get_state() == TaskState::Cancelled);
+        }
+        EXPECT_LT(independent_runs.load(), 1000);
+        int cancelled = 0;
+        for (auto& task : independent) {
+            ASSERT_TRUE(task.is_finished());
+            cancelled += task.get_state() == TaskState::Cancelled ? 1 : 0;
+        }
+        EXPECT_EQ(cancelled + independent_runs.load(), 1000);
+    }
+}
+
+// Test without cancel_on_failure only the dependents of a failed task are skipped
+TEST(ThreadPoolExecutorTest, FailureSkipsOnlyDependents)
+{
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(2),
+                                ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+    Task<void> failing;
+    failing.set_callable([]() {
+        throw std::logic_error("failed");
+    });
+    Task<void, void> dependent;
+    dependent.set_callable([]() {});
+    dependent.add_inward_edge<void>(failing.get_outward_edge());
+    Task<void> unrelated;
+    unrelated.set_callable([]() {});
+
+    executor.add_task(&failing);
+    executor.add_task(&dependent);
+    executor.add_task(&unrelated);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(executor.get_failed_task(), &failing);
+    EXPECT_EQ(dependent.get_state(), TaskState::Failed);
+    EXPECT_THROW(dependent.rethrow_if_failed(), std::logic_error);
+    EXPECT_EQ(unrelated.get_state(), TaskState::Complete);
+}
+
+// Test cancel releases a task blocked on its inputs and is visible to running callables
+TEST(ThreadPoolExecutorTest, CancelReleasesBlockedWaiters)
+{
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(2));
+
+    std::atomic<bool> saw_stop{false};
+    Task<int> slow;
+    slow.set_callable([&saw_stop]() -> int {
+        while (!this_task::stop_requested()) {
+            std::this_thread::yield();
+        }
+        saw_stop = true;
+        return 0;
+    });
+    Task<void, int> blocked;
+    blocked.set_callable([](int) {});
+    blocked.add_inward_edge<int>(slow.get_outward_edge());
+
+    executor.add_task(&slow);
+    executor.add_task(&blocked);
+    executor.run();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    executor.cancel();
+    executor.wait();
+
+    EXPECT_TRUE(saw_stop.load());
+    EXPECT_EQ(slow.get_state(), TaskState::Complete);
+    EXPECT_EQ(blocked.get_state(), TaskState::Cancelled);
+    EXPECT_TRUE(executor.get_stop_token().stop_requested());
+}
+
+// Test run_timeout stops the run at its deadline and drops the tasks not started yet
+TEST(ThreadPoolExecutorTest, RunTimeout)
+{
+    for (auto mode : {DispatchMode::Eager, DispatchMode::DependencyDriven}) {
+        ThreadPoolExecutor executor(std::make_unique<ThreadPool>(1),
+                                    ExecutorOptions{.dispatch_mode = mode, .run_timeout = std::chrono::milliseconds(20)});
+
+        Task<void> slow;
+        slow.set_callable([]() {
+            while (!this_task::stop_requested()) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+        Task<void, void> after;
+        after.set_callable([]() {});
+        after.add_inward_edge<void>(slow.get_outward_edge());
+
+        executor.add_task(&slow);
+        executor.add_task(&after);
+        auto start = std::chrono::steady_clock::now();
+        executor.run();
+        executor.wait();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        EXPECT_GE(elapsed, std::chrono::milliseconds(20));
+        EXPECT_LT(elapsed, std::chrono::seconds(5));
+        EXPECT_EQ(slow.get_state(), TaskState::Complete);
+        EXPECT_EQ(after.get_state(), TaskState::Cancelled);
+        EXPECT_THROW(after.rethrow_if_failed(), DeadlineExceeded);
+
+        // The next run gets a fresh stop source and deadline
+        slow.set_callable([]() {});
+        executor.run();
+        executor.wait();
+        EXPECT_EQ(after.get_state(), TaskState::Complete);
+    }
+}
+
 // Test ThreadPoolExecutor wait without run
 TEST(ThreadPoolExecutorTest, WaitWithoutRun)
 {
@@ -283,4 +447,333 @@ TEST(ThreadPoolExecutorTest, MixedTaskTypes)
     EXPECT_EQ(result, 100);
 }
 
+// Test dependency-driven dispatch resolves a chain added in reverse order
+TEST(ThreadPoolExecutorTest, DependencyDrivenChain)
+{
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    constexpr int kChainLength = 64;
+    std::vector<Task<int, int>> chain(kChainLength);
+    chain[0].set_callable([](int) -> int {
+        return 1;
+    });
+    for (int i = 1; i < kChainLength; i++) {
+        chain[i].set_callable([](int v) -> int {
+            return v + 1;
+        });
+        chain[i].add_inward_edge<int>(chain[i - 1].get_outward_edge());
+    }
+
+    for (int i = kChainLength - 1; i >= 0; i--) {
+        executor.add_task(&chain[i]);
+    }
+
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(chain.back().get_result(), kChainLength);
+}
+
+// Test dependency-driven dispatch with a diamond and multiple inputs
+TEST(ThreadPoolExecutorTest, DependencyDrivenDiamond)
+{
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    Task<int> top;
+    top.set_callable([]() -> int {
+        return 5;
+    });
+
+    Task<int, int> left;
+    left.set_callable([](int v) -> int {
+        return v * 2;
+    });
+    left.add_inward_edge<int>(top.get_outward_edge());
+
+    Task<int, int> right;
+    right.set_callable([](int v) -> int {
+        return v + 3;
+    });
+    right.add_inward_edge<int>(top.get_outward_edge());
+
+    Task<int, int, int> bottom;
+    bottom.set_callable([](int a, int b) -> int {
+        return a * b;
+    });
+    bottom.add_inward_edge<0>(left.get_outward_edge());
+    bottom.add_inward_edge<1>(right.get_outward_edge());
+
+    executor.add_task(&bottom);
+    executor.add_task(&right);
+    executor.add_task(&left);
+    executor.add_task(&top);
+
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(bottom.get_result(), 80);
+}
+
+// Test dependency-driven dispatch does not track predecessors outside the executor
+TEST(ThreadPoolExecutorTest, DependencyDrivenExternalPredecessor)
+{
+    Task<int> external;
+    external.set_callable([]() -> int {
+        return 7;
+    });
+    external.run();
+
+    Task<int, int> consumer;
+    consumer.set_callable([](int v) -> int {
+        return v + 1;
+    });
+    consumer.add_inward_edge<int>(external.get_outward_edge());
+
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+    executor.add_task(&consumer);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(consumer.get_result(), 8);
+}
+
+// Test cancel drops successors as Cancelled instead of running them in dependency-driven mode
+TEST(ThreadPoolExecutorTest, DependencyDrivenCancel)
+{
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+
+    Task<void> head;
+    head.set_callable([&started, &release]() {
+        started.store(true, std::memory_order_release);
+        while (!release.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    });
+
+    std::atomic<bool> tail_called{false};
+    Task<void, void> tail;
+    tail.set_callable([&tail_called]() {
+        tail_called = true;
+    });
+    tail.add_inward_edge<0>(head.get_outward_edge());
+
+    executor.add_task(&head);
+    executor.add_task(&tail);
+    executor.run();
+
+    while (!started.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    executor.cancel();
+    release.store(true, std::memory_order_release);
+    executor.wait();
+
+    EXPECT_EQ(head.get_state(), TaskState::Complete);
+    EXPECT_EQ(tail.get_state(), TaskState::Cancelled);
+    EXPECT_FALSE(tail_called.load());
+}
+
+// Test a chain runs as continuations on a single worker
+TEST(ThreadPoolExecutorTest, ContinuationRunsChainOnOneWorker)
+{
+    constexpr int kChainLength = 16;
+    std::vector<std::thread::id> workers(kChainLength);
+    std::vector<Task<int, int>> chain(kChainLength);
+    for (int i = 0; i < kChainLength; i++) {
+        chain[i].set_callable([&workers, i](int v) -> int {
+            workers[i] = std::this_thread::get_id();
+            return v + 1;
+        });
+        if (i > 0) {
+            chain[i].add_inward_edge<int>(chain[i - 1].get_outward_edge());
+        }
+    }
+
+    ThreadPoolExecutor executor(
+        std::make_unique<ThreadPool>(4),
+        ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven, .max_continuation_depth = kChainLength});
+    for (auto& task : chain) {
+        executor.add_task(&task);
+    }
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(chain.back().get_result(), kChainLength);
+    for (int i = 1; i < kChainLength; i++) {
+        EXPECT_EQ(workers[i], workers[0]) << "Task " << i << " was requeued";
+    }
+}
+
+// Test continuation depth bounds and fan-out still run every task
+TEST(ThreadPoolExecutorTest, ContinuationDepthAndFanOut)
+{
+    for (uint32_t depth : {0U, 1U, 3U}) {
+        Task<int> top;
+        top.set_callable([]() -> int {
+            return 1;
+        });
+        std::vector<Task<int, int>> fan(8);
+        std::vector<Task<int, int>> chain(10);
+        for (auto& task : fan) {
+            task.set_callable([](int v) -> int {
+                return v + 1;
+            });
+            task.add_inward_edge<int>(top.get_outward_edge());
+        }
+        for (size_t i = 0; i < chain.size(); i++) {
+            chain[i].set_callable([](int v) -> int {
+                return v + 1;
+            });
+            chain[i].add_inward_edge<int>(i == 0 ? fan[0].get_outward_edge() : chain[i - 1].get_outward_edge());
+        }
+
+        ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven,
+                                                    .scheduling_policy = SchedulingPolicy::CriticalPath,
+                                                    .max_continuation_depth = depth});
+        executor.add_task(&top);
+        for (auto& task : fan) {
+            executor.add_task(&task);
+        }
+        for (auto& task : chain) {
+            executor.add_task(&task);
+        }
+        executor.run();
+        executor.wait();
+
+        for (auto& task : fan) {
+            EXPECT_EQ(task.get_result(), 2) << "depth " << depth;
+        }
+        EXPECT_EQ(chain.back().get_result(), 12) << "depth " << depth;
+    }
+}
+
+// Test CompiledGraph exposes roots and successors in topological order
+TEST(CompiledGraphTest, Structure)
+{
+    Task<int> top;
+    Task<int, int> left;
+    Task<int, int> right;
+    Task<int, int, int> bottom;
+    left.add_inward_edge<int>(top.get_outward_edge());
+    right.add_inward_edge<int>(top.get_outward_edge());
+    bottom.add_inward_edge<0>(left.get_outward_edge());
+    bottom.add_inward_edge<1>(right.get_outward_edge());
+
+    CompiledGraph graph{std::vector<ITask*>{&bottom, &right, &left, &top}};
+
+    ASSERT_EQ(graph.size(), 4);
+    ASSERT_EQ(graph.get_roots().size(), 1);
+    const size_t root = graph.get_roots()[0];
+    EXPECT_EQ(graph.get_task(root), &top);
+    EXPECT_EQ(graph.get_successors(root).size(), 2);
+    EXPECT_EQ(graph.get_task(graph.size() - 1), &bottom);
+    EXPECT_TRUE(graph.get_successors(graph.size() - 1).empty());
+}
+
+// Test a compiled graph can be executed many times on the same executor
+TEST(CompiledGraphTest, RunRepeatedly)
+{
+    std::atomic<int> base{1};
+    Task<int> top;
+    top.set_callable([&base]() -> int {
+        return base.load();
+    });
+    Task<int, int> left;
+    left.set_callable([](int v) -> int {
+        return v * 2;
+    });
+    left.add_inward_edge<int>(top.get_outward_edge());
+    Task<int, int> right;
+    right.set_callable([](int v) -> int {
+        return v * 3;
+    });
+    right.add_inward_edge<int>(top.get_outward_edge());
+    Task<int, int, int> bottom;
+    bottom.set_callable([](int a, int b) -> int {
+        return a + b;
+    });
+    bottom.add_inward_edge<0>(left.get_outward_edge());
+    bottom.add_inward_edge<1>(right.get_outward_edge());
+
+    CompiledGraph graph{std::vector<ITask*>{&top, &left, &right, &bottom}};
+    ThreadPoolExecutor executor;
+
+    for (int iteration = 1; iteration <= 20; iteration++) {
+        base.store(iteration);
+        executor.run(graph);
+        executor.wait();
+        EXPECT_EQ(bottom.get_state(), TaskState::Complete);
+        EXPECT_EQ(bottom.get_result(), iteration * 5);
+    }
+}
+
+// Test CompiledGraph critical-path priorities count the longest downstream chain
+TEST(CompiledGraphTest, Priorities)
+{
+    Task<void> head;
+    Task<void, void> middle;
+    Task<void, void> tail;
+    Task<void> lone;
+    middle.add_inward_edge<0>(head.get_outward_edge());
+    tail.add_inward_edge<0>(middle.get_outward_edge());
+
+    std::vector<ITask*> tasks{&lone, &head, &middle, &tail};
+    CompiledGraph graph{tasks};
+
+    auto priority_of = [&graph](const ITask* task) {
+        for (size_t i = 0; i < graph.size(); i++) {
+            if (graph.get_task(i) == task) {
+                return graph.get_priority(i);
+            }
+        }
+        return uint64_t{0};
+    };
+    EXPECT_EQ(priority_of(&head), 3);
+    EXPECT_EQ(priority_of(&middle), 2);
+    EXPECT_EQ(priority_of(&tail), 1);
+    EXPECT_EQ(priority_of(&lone), 1);
+}
+
+// Test critical-path scheduling starts the root of the longest chain first
+TEST(ThreadPoolExecutorTest, CriticalPathStartsLongestChainFirst)
+{
+    std::mutex order_mtx;
+    std::vector<std::string> order;
+    auto record = [&order_mtx, &order](std::string name) {
+        std::lock_guard lck{order_mtx};
+        order.emplace_back(std::move(name));
+    };
+
+    Task<void> lone;
+    lone.set_callable([&record]() {
+        record("lone");
+    });
+    Task<void> head;
+    head.set_callable([&record]() {
+        record("head");
+    });
+    Task<void, void> tail;
+    tail.set_callable([&record]() {
+        record("tail");
+    });
+    tail.add_inward_edge<0>(head.get_outward_edge());
+
+    // A single worker makes the start order observable
+    ThreadPoolExecutor executor(
+        std::make_unique<ThreadPool>(1),
+        ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven,
+                        .scheduling_policy = SchedulingPolicy::CriticalPath});
+    executor.add_task(&lone);
+    executor.add_task(&head);
+    executor.add_task(&tail);
+    executor.run();
+    executor.wait();
+
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order.front(), "head");
+}
+
 } // namespace tw::test
@@ -5,8 +5,12 @@
 #include "TaskWeave/Edge.h"
 #include "TaskWeave/Node.h"
 #include "TaskWeave/Task.h"
+#include "TaskWeave/Watchdog.h"
 
+#include <chrono>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <stop_token>
 #include <thread>
 
 namespace tw::test {
@@ -81,6 +85,216 @@ TEST(TaskTest, Wait)
     runner.join();
 }
 
+// Test Task reset allows the task and its consumer to run again
+TEST(TaskTest, Reset)
+{
+    int base = 1;
+    Task<int> producer;
+    producer.set_callable([&base]() -> int {
+        return base;
+    });
+
+    Task<int, int> consumer;
+    consumer.set_callable([](int value) -> int {
+        return value * 10;
+    });
+    consumer.add_inward_edge<int>(producer.get_outward_edge());
+
+    producer.run();
+    consumer.run();
+    EXPECT_EQ(consumer.get_result(), 10);
+
+    producer.reset();
+    consumer.reset();
+    EXPECT_EQ(producer.get_state(), TaskState::Incomplete);
+    EXPECT_EQ(consumer.get_state(), TaskState::Incomplete);
+    EXPECT_FALSE(producer.get_outward_edge()->is_retrievable());
+
+    base = 2;
+    producer.run();
+    consumer.run();
+    EXPECT_EQ(consumer.get_state(), TaskState::Complete);
+    EXPECT_EQ(consumer.get_result(), 20);
+}
+
+// Test an exception is captured as Failed and dependents skip execution with the same exception
+TEST(TaskTest, ExceptionPropagatesToDependents)
+{
+    Task<int> producer;
+    producer.set_callable([]() -> int {
+        throw std::runtime_error("no input");
+    });
+
+    bool consumer_called = false;
+    Task<int, int> consumer;
+    consumer.set_callable([&consumer_called](int value) -> int {
+        consumer_called = true;
+        return value;
+    });
+    consumer.add_inward_edge<int>(producer.get_outward_edge());
+
+    Task<void, int> sink;
+    sink.set_callable([](int) {});
+    sink.add_inward_edge<int>(consumer.get_outward_edge());
+
+    EXPECT_NO_THROW(producer.run());
+    consumer.run();
+    sink.run();
+
+    EXPECT_EQ(producer.wait(), TaskState::Failed);
+    EXPECT_TRUE(producer.get_outward_edge()->has_failed());
+    EXPECT_EQ(consumer.get_state(), TaskState::Failed);
+    EXPECT_EQ(sink.get_state(), TaskState::Failed);
+    EXPECT_FALSE(consumer_called);
+    EXPECT_EQ(sink.get_exception(), producer.get_exception());
+    EXPECT_THROW(sink.rethrow_if_failed(), std::runtime_error);
+
+    // Reset clears the failure
+    producer.reset();
+    EXPECT_EQ(producer.get_exception(), nullptr);
+    EXPECT_FALSE(producer.get_outward_edge()->has_failed());
+}
+
+// Test a cancelled task is not run and cancels a dependent already waiting on it
+TEST(TaskTest, CancelWakesWaitingDependent)
+{
+    bool producer_called = false;
+    Task<int> producer;
+    producer.set_callable([&producer_called]() -> int {
+        producer_called = true;
+        return 1;
+    });
+
+    Task<void, int> consumer;
+    consumer.set_callable([](int) {});
+    consumer.add_inward_edge<int>(producer.get_outward_edge());
+
+    std::thread runner([&consumer]() {
+        consumer.run();
+    });
+    producer.cancel();
+    runner.join();
+
+    EXPECT_FALSE(producer_called);
+    EXPECT_EQ(producer.get_state(), TaskState::Cancelled);
+    EXPECT_EQ(consumer.wait(), TaskState::Cancelled);
+    EXPECT_THROW(consumer.rethrow_if_failed(), TaskCancelled);
+}
+
+// Test a task still waiting for its inputs at its deadline is dropped with DeadlineExceeded
+TEST(TaskTest, DeadlineDropsWaitingTask)
+{
+    Task<int> producer;
+    producer.set_callable([]() -> int {
+        return 1;
+    });
+
+    bool consumer_called = false;
+    Task<void, int> consumer;
+    consumer.set_callable([&consumer_called](int) {
+        consumer_called = true;
+    });
+    consumer.add_inward_edge<int>(producer.get_outward_edge());
+    consumer.set_deadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(10));
+
+    // The producer never runs: only the deadline can release the consumer
+    consumer.run();
+
+    EXPECT_EQ(consumer.get_state(), TaskState::Cancelled);
+    EXPECT_FALSE(consumer_called);
+    EXPECT_THROW(consumer.rethrow_if_failed(), DeadlineExceeded);
+}
+
+// Test a stop callback run by the watchdog may register and reset timers itself
+TEST(TaskTest, WatchdogStopCallbackUsesWatchdog)
+{
+    std::stop_source first;
+    std::stop_source second;
+    Watchdog::Timer second_timer;
+    std::stop_callback on_first(first.get_token(), [&second, &second_timer]() {
+        Watchdog::Timer dropped(std::chrono::steady_clock::now() + std::chrono::seconds(10), std::stop_source{});
+        dropped.reset();
+        second_timer = Watchdog::Timer(std::chrono::steady_clock::now() + std::chrono::milliseconds(1), second);
+    });
+    const Watchdog::Timer first_timer(std::chrono::steady_clock::now() + std::chrono::milliseconds(1), first);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!second.stop_requested() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(first.stop_requested());
+    EXPECT_TRUE(second.stop_requested());
+}
+
+namespace {
+
+/**
+ * @brief Payload counting how many times it was copied.
+ */
+struct CopyCounted {
+    CopyCounted() = default;
+
+    explicit CopyCounted(int* copies)
+        : copies(copies)
+    {
+    }
+
+    CopyCounted(const CopyCounted& other)
+        : copies(other.copies)
+        , value(other.value)
+    {
+        if (copies) {
+            ++*copies;
+        }
+    }
+
+    CopyCounted(CopyCounted&&) noexcept = default;
+
+    auto operator=(const CopyCounted& other) -> CopyCounted&
+    {
+        copies = other.copies;
+        value = other.value;
+        if (copies) {
+            ++*copies;
+        }
+        return *this;
+    }
+
+    auto operator=(CopyCounted&&) noexcept -> CopyCounted& = default;
+
+    int* copies = nullptr;
+    int value = 0;
+};
+
+} // namespace
+
+// Test Task results are moved into the edge and, for the last consumer, out of it
+TEST(TaskTest, MoveToLastConsumerAvoidsCopies)
+{
+    int copies = 0;
+
+    Task<CopyCounted> producer;
+    producer.set_callable([&copies]() {
+        CopyCounted result{&copies};
+        result.value = 21;
+        return result;
+    });
+    producer.set_out_edge_transfer_mode(EdgeTransferMode::MoveToLastConsumer);
+
+    Task<int, CopyCounted> consumer;
+    consumer.set_callable([](CopyCounted input) -> int {
+        return input.value * 2;
+    });
+    consumer.add_inward_edge<CopyCounted>(producer.get_outward_edge());
+
+    producer.run();
+    EXPECT_EQ(producer.get_result_ref().value, 21);
+    consumer.run();
+
+    EXPECT_EQ(consumer.get_result(), 42);
+    EXPECT_EQ(copies, 0);
+}
+
 // Test Task as_node
 TEST(TaskTest, AsNode)
 {
@@ -0,0 +1,245 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/TaskGroup.h"
+#include "Executor/ThreadPool.h"
+#include "Executor/ThreadPoolExecutor.h"
+#include "Executor/WorkStealingThreadPool.h"
+#include "TaskWeave/Task.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace tw::test {
+
+namespace {
+
+/**
+ * @brief Recursive fork-join sum of [begin, end), one group per level.
+ */
+int parallel_sum(int begin, int end)
+{
+    if (end - begin <= 4) {
+        int sum = 0;
+        for (int i = begin; i < end; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+    const int middle = begin + (end - begin) / 2;
+    int left = 0;
+    int right = 0;
+    TaskGroup group;
+    group.spawn([&left, begin, middle]() {
+        left = parallel_sum(begin, middle);
+    });
+    right = parallel_sum(middle, end);
+    group.join();
+    return left + right;
+}
+
+} // namespace
+
+// Test current() is only set inside executor jobs
+TEST(TaskGroupTest, CurrentExecutor)
+{
+    EXPECT_EQ(ThreadPoolExecutor::current(), nullptr);
+
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+    ThreadPoolExecutor* seen = nullptr;
+    Task<void> task;
+    task.set_callable([&seen]() {
+        seen = ThreadPoolExecutor::current();
+    });
+    executor.add_task(&task);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(seen, &executor);
+    EXPECT_EQ(ThreadPoolExecutor::current(), nullptr);
+}
+
+// Test a running task spawns a runtime-sized fan-out and joins it before returning
+TEST(TaskGroupTest, SpawnFromRunningTask)
+{
+    ThreadPoolExecutor executor(ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    Task<int> partition_count;
+    partition_count.set_callable([]() -> int {
+        return 16;
+    });
+    Task<int, int> parent;
+    parent.set_callable([](int count) -> int {
+        std::vector<int> partial(count);
+        TaskGroup group;
+        for (int i = 0; i < count; i++) {
+            group.spawn([&partial, i]() {
+                partial[i] = i * 10;
+            });
+        }
+        group.join();
+        return std::accumulate(partial.begin(), partial.end(), 0);
+    });
+    parent.add_inward_edge<int>(partition_count.get_outward_edge());
+    Task<int, int> consumer;
+    consumer.set_callable([](int sum) -> int {
+        return sum + 1;
+    });
+    consumer.add_inward_edge<int>(parent.get_outward_edge());
+
+    executor.add_task(&partition_count);
+    executor.add_task(&parent);
+    executor.add_task(&consumer);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(parent.get_result(), 1200);
+    EXPECT_EQ(consumer.get_result(), 1201);
+}
+
+// Test joining on a single worker: the children can only run through the helping join
+TEST(TaskGroupTest, JoinHelpsOnSingleWorker)
+{
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(1),
+                                ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    std::atomic<int> children{0};
+    Task<int> parent;
+    parent.set_callable([&children]() -> int {
+        TaskGroup group;
+        for (int i = 0; i < 8; i++) {
+            group.spawn([&children]() {
+                children++;
+            });
+        }
+        group.join();
+        return children.load();
+    });
+
+    executor.add_task(&parent);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(parent.get_result(), 8);
+}
+
+// Test child tasks wired with edges at runtime run dependency-driven
+TEST(TaskGroupTest, SpawnGraph)
+{
+    ThreadPoolExecutor executor(std::make_unique<WorkStealingThreadPool>(2),
+                                ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    Task<int> parent;
+    parent.set_callable([]() -> int {
+        // Diamond built only now: source -> {left, right} -> sink
+        Task<int> source;
+        source.set_callable([]() -> int {
+            return 3;
+        });
+        Task<int, int> left;
+        left.set_callable([](int v) -> int {
+            return v + 1;
+        });
+        left.add_inward_edge<int>(source.get_outward_edge());
+        Task<int, int> right;
+        right.set_callable([](int v) -> int {
+            return v * 2;
+        });
+        right.add_inward_edge<int>(source.get_outward_edge());
+        Task<int, int, int> sink;
+        sink.set_callable([](int a, int b) -> int {
+            return a * b;
+        });
+        sink.add_inward_edge<0>(left.get_outward_edge());
+        sink.add_inward_edge<1>(right.get_outward_edge());
+
+        TaskGroup group;
+        group.spawn_graph(std::vector<ITask*>{&sink, &right, &left, &source});
+        group.join();
+        return sink.get_result();
+    });
+
+    executor.add_task(&parent);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(parent.get_result(), 24);
+}
+
+// Test recursive fork-join with nested groups
+TEST(TaskGroupTest, NestedGroups)
+{
+    ThreadPoolExecutor executor(std::make_unique<WorkStealingThreadPool>(2),
+                                ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    Task<int> root;
+    root.set_callable([]() -> int {
+        return parallel_sum(0, 1000);
+    });
+    executor.add_task(&root);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(root.get_result(), 499500);
+}
+
+// Test joining with eager dispatch (no helping) and spawning without a join
+TEST(TaskGroupTest, EagerDispatchAndDetachedSpawn)
+{
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(2));
+
+    std::atomic<int> detached{0};
+    Task<int> parent;
+    parent.set_callable([&detached]() -> int {
+        ThreadPoolExecutor::current()->spawn([&detached]() {
+            detached++;
+        });
+        std::atomic<int> joined{0};
+        TaskGroup group;
+        for (int i = 0; i < 4; i++) {
+            group.spawn([&joined]() {
+                joined++;
+            });
+        }
+        group.join();
+        return joined.load();
+    });
+
+    executor.add_task(&parent);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(parent.get_result(), 4);
+    EXPECT_EQ(detached.load(), 1);
+}
+
+// Test joining with eager dispatch on a single worker: the join runs its own children
+TEST(TaskGroupTest, EagerJoinOnSingleWorker)
+{
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(1));
+
+    std::atomic<int> children{0};
+    Task<int> parent;
+    parent.set_callable([&children]() -> int {
+        TaskGroup group;
+        for (int i = 0; i < 4; i++) {
+            group.spawn([&children]() {
+                children++;
+            });
+        }
+        group.join();
+        return children.load();
+    });
+
+    executor.add_task(&parent);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(parent.get_result(), 4);
+}
+
+} // namespace tw::test
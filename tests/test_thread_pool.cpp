@@ -6,8 +6,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <gtest/gtest.h>
+#include <ranges>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace tw::test {
 
@@ -151,6 +155,95 @@ TEST(ThreadPoolTest, ClearQueuedTasks)
     EXPECT_LT(counter.load(std::memory_order_acquire), 10);
 }
 
+// Test ThreadPool clear_queued_tasks wakes a waiter once nothing is left
+TEST(ThreadPoolTest, ClearQueuedTasksWakesWaiter)
+{
+    ThreadPool pool(1);
+
+    for (int i = 0; i < 10; i++) {
+        pool.add_task([]() {});
+    }
+
+    // Workers are not running, so the waiter can only be released by the clear
+    std::thread waiter([&pool]() {
+        pool.wait();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.clear_queued_tasks();
+    waiter.join();
+
+    EXPECT_TRUE(pool.is_idle());
+}
+
+// Test try_execute_one runs the front task on the calling thread
+TEST(ThreadPoolTest, TryExecuteOne)
+{
+    ThreadPool pool(2);
+    std::vector<int> order;
+
+    // Workers are not running: only the calling thread can execute the tasks
+    for (int i = 0; i < 3; i++) {
+        pool.add_task([&order, i]() {
+            order.push_back(i);
+        });
+    }
+    while (pool.try_execute_one()) {
+    }
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    EXPECT_TRUE(pool.is_idle());
+}
+
+// Test High tasks jump ahead of Normal and Background tasks submitted earlier
+TEST(ThreadPoolTest, PriorityLanes)
+{
+    ThreadPool pool(1);
+    std::vector<std::string> order;
+
+    // Workers are not running yet, so every task is queued before the first pop
+    for (int i = 0; i < 2; i++) {
+        pool.add_task(TaskPriority::Background, [&order, i]() {
+            order.push_back(std::to_string(i));
+            order.back().insert(0, 1, 'b');
+        });
+        pool.add_task([&order, i]() {
+            order.push_back(std::to_string(i));
+            order.back().insert(0, 1, 'n');
+        });
+        pool.add_task(TaskPriority::High, [&order, i]() {
+            order.push_back(std::to_string(i));
+            order.back().insert(0, 1, 'h');
+        });
+    }
+    EXPECT_EQ(pool.size(), 6);
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(order, (std::vector<std::string>{"h0", "h1", "n0", "n1", "b0", "b1"}));
+}
+
+// Test a lower lane gets a turn after being passed over starvation_limit times
+TEST(ThreadPoolTest, PriorityLanesStarvationLimit)
+{
+    ThreadPool pool(1);
+    pool.set_starvation_limit(3);
+    EXPECT_EQ(pool.get_starvation_limit(), 3);
+    std::vector<char> order;
+
+    pool.add_task(TaskPriority::Background, [&order]() {
+        order.push_back('b');
+    });
+    for (int i = 0; i < 6; i++) {
+        pool.add_task(TaskPriority::High, [&order]() {
+            order.push_back('h');
+        });
+    }
+    while (pool.try_execute_one()) {
+    }
+
+    EXPECT_EQ(order, (std::vector<char>{'h', 'h', 'h', 'b', 'h', 'h', 'h'}));
+}
+
 // Test ThreadPool is_idle
 TEST(ThreadPoolTest, IsIdle)
 {
@@ -169,7 +262,7 @@ TEST(ThreadPoolTest, IsIdle)
     EXPECT_TRUE(pool.is_idle());
 }
 
-// Test ThreadPool get_queued_tasks
+// Test ThreadPool queued task count while a worker is busy
 TEST(ThreadPoolTest, GetQueuedTasks)
 {
     ThreadPool pool(1); // Use single worker to control execution
@@ -200,8 +293,7 @@ TEST(ThreadPoolTest, GetQueuedTasks)
         });
     }
 
-    auto queued = pool.get_queued_tasks();
-    EXPECT_EQ(queued.size(), 5);
+    EXPECT_EQ(pool.size(), 5);
 
     done.store(true, std::memory_order_release);
     pool.wait();
@@ -310,4 +402,266 @@ TEST(ThreadPoolTest, OnCompleteCallbackCalledOnce)
     EXPECT_EQ(callback_count.load(std::memory_order_acquire), 1);
 }
 
+// Test ThreadPool add_tasks submits a whole batch
+TEST(ThreadPoolTest, AddTasksBatch)
+{
+    ThreadPool pool(2);
+
+    std::atomic<int> counter{0};
+    std::vector<std::function<void()>> batch(100, [&counter]() {
+        counter.fetch_add(1, std::memory_order_acq_rel);
+    });
+
+    EXPECT_EQ(pool.add_tasks(batch), 100);
+    EXPECT_EQ(pool.size(), 100);
+    EXPECT_EQ(pool.active_task_count(), 100);
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(std::memory_order_acquire), 100);
+    EXPECT_TRUE(pool.empty());
+}
+
+// Test ThreadPool add_tasks skips null callables and accepts views
+TEST(ThreadPoolTest, AddTasksSkipsNull)
+{
+    ThreadPool pool(2);
+
+    std::atomic<int> counter{0};
+    std::vector<std::function<void()>> batch{
+        nullptr,
+        [&counter]() {
+            counter++;
+        },
+        nullptr,
+    };
+    EXPECT_EQ(pool.add_tasks(batch), 1);
+
+    auto generated = std::views::iota(0, 5) | std::views::transform([&counter](int i) {
+                         return [&counter, i]() {
+                             counter += i;
+                         };
+                     });
+    EXPECT_EQ(pool.add_tasks(generated), 5);
+
+    std::vector<std::function<void()>> empty_batch;
+    EXPECT_EQ(pool.add_tasks(empty_batch), 0);
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 11);
+}
+
+// Test ThreadPool add_tasks wakes workers that are already parked
+TEST(ThreadPoolTest, AddTasksWakesIdleWorkers)
+{
+    ThreadPool pool(4);
+    pool.run();
+
+    std::atomic<int> counter{0};
+    for (int round = 0; round < 20; round++) {
+        std::vector<std::function<void()>> batch(round + 1, [&counter]() {
+            counter.fetch_add(1, std::memory_order_acq_rel);
+        });
+        pool.add_tasks(batch);
+        pool.wait();
+    }
+
+    EXPECT_EQ(counter.load(), 210);
+}
+
+
+namespace {
+
+/**
+ * @brief Polls a condition until it holds or a generous timeout passes.
+ */
+template<typename Pred>
+auto eventually(Pred pred) -> bool
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+// Test a fixed-size ThreadPool starts all its workers and keeps them
+TEST(ThreadPoolTest, FixedSizeKeepsWorkers)
+{
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.live_worker_count(), 0);
+
+    pool.run();
+    EXPECT_EQ(pool.live_worker_count(), 3);
+    EXPECT_EQ(pool.get_options().min_threads, 3);
+    EXPECT_EQ(pool.get_options().max_threads, 3);
+}
+
+// Test an elastic ThreadPool grows while work is backed up and retires idle workers
+TEST(ThreadPoolTest, ElasticGrowsAndRetires)
+{
+    ThreadPool pool(ThreadPoolOptions{.min_threads = 1, .max_threads = 4, .idle_timeout = std::chrono::milliseconds(20)});
+    pool.run();
+    EXPECT_EQ(pool.live_worker_count(), 1);
+    EXPECT_EQ(pool.worker_count(), 4);
+
+    // Every task waits for all four to be running: only possible with four workers
+    std::atomic<int> started{0};
+    for (int i = 0; i < 4; i++) {
+        pool.add_task([&started]() {
+            started.fetch_add(1, std::memory_order_acq_rel);
+            while (started.load(std::memory_order_acquire) < 4) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(started.load(), 4);
+    EXPECT_LE(pool.live_worker_count(), 4);
+
+    EXPECT_TRUE(eventually([&pool]() {
+        return pool.live_worker_count() == 1;
+    }));
+
+    // Retired slots are reused
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 8; i++) {
+        pool.add_task([&counter]() {
+            counter.fetch_add(1, std::memory_order_acq_rel);
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(counter.load(), 8);
+}
+
+// Test an elastic ThreadPool starts a worker for queued work while the others are blocked
+TEST(ThreadPoolTest, ElasticGrowsOnBlocking)
+{
+    ThreadPool pool(ThreadPoolOptions{.min_threads = 0, .max_threads = 1, .idle_timeout = std::chrono::milliseconds(20)});
+    pool.run();
+    EXPECT_EQ(pool.live_worker_count(), 0);
+
+    // The first task blocks until the second one runs: with one runnable worker, only growth unblocks it
+    std::atomic<bool> released{false};
+    pool.add_task([&released]() {
+        BlockingRegion blocking;
+        while (!released.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+    EXPECT_TRUE(eventually([&pool]() {
+        return pool.size() == 0;
+    }));
+    pool.add_task([&released]() {
+        released.store(true, std::memory_order_release);
+    });
+    pool.wait();
+    EXPECT_TRUE(released.load());
+
+    EXPECT_TRUE(eventually([&pool]() {
+        return pool.live_worker_count() == 0;
+    }));
+}
+
+
+// Test every idle policy runs bursts of tasks submitted while workers poll, yield or park
+TEST(ThreadPoolTest, IdlePolicies)
+{
+    for (auto policy : {IdlePolicy{.spin_count = 0, .yield_count = 0}, IdlePolicy{.spin_count = 0, .yield_count = 64},
+                        IdlePolicy{.spin_count = 4096, .yield_count = 0}, IdlePolicy{}}) {
+        ThreadPool pool(ThreadPoolOptions{.min_threads = 2,
+                                          .max_threads = 2,
+                                          .idle_timeout = std::chrono::milliseconds::zero(),
+                                          .idle_policy = policy});
+        pool.run();
+
+        std::atomic<int> counter{0};
+        for (int round = 0; round < 50; round++) {
+            for (int i = 0; i < 3; i++) {
+                pool.add_task([&counter]() {
+                    counter.fetch_add(1, std::memory_order_acq_rel);
+                });
+            }
+            pool.wait();
+            if (round % 10 == 0) {
+                // Let the workers run out of polling and park
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        EXPECT_EQ(counter.load(), 150);
+        EXPECT_EQ(pool.live_worker_count(), 2);
+    }
+}
+
+// Test the metrics count every task once, and stay empty unless enabled
+TEST(ThreadPoolTest, Metrics)
+{
+    ThreadPool plain(2);
+    plain.run();
+    plain.add_task([]() {});
+    plain.wait();
+    EXPECT_TRUE(plain.get_metrics().workers.empty());
+
+    ThreadPool pool(ThreadPoolOptions{.min_threads = 2,
+                                      .max_threads = 2,
+                                      .idle_timeout = std::chrono::milliseconds::zero(),
+                                      .idle_policy = IdlePolicy{.spin_count = 0, .yield_count = 0},
+                                      .collect_metrics = true});
+    // Before run(), only the calling thread can take the task
+    pool.add_task([]() {});
+    EXPECT_TRUE(pool.try_execute_one());
+    pool.run();
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < 20; i++) {
+            pool.add_task([]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            });
+        }
+        pool.wait();
+        // Let the workers park, so the next round wakes them
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const auto metrics = pool.get_metrics();
+    ASSERT_EQ(metrics.workers.size(), 2);
+    const auto total = metrics.total();
+    EXPECT_EQ(total.tasks_executed, 101);
+    EXPECT_EQ(metrics.helpers.tasks_executed, 1);
+    EXPECT_EQ(metrics.helpers.queue_latency_ns.count(), 1);
+    // One in kLatencySampleInterval submissions is timed: the 1st (helper) and the 65th
+    EXPECT_EQ(total.queue_latency_ns.count(), (101 + ThreadPoolMetrics::kLatencySampleInterval - 1) /
+                                                  ThreadPoolMetrics::kLatencySampleInterval);
+    EXPECT_EQ(metrics.queue_depth.count(), 101);
+    EXPECT_GE(total.busy_ns, 100 * 100'000ULL);
+    EXPECT_GT(total.idle_ns, 0);
+    EXPECT_GE(total.wakeups, 1);
+    EXPECT_LE(total.spurious_wakeups, total.wakeups);
+    EXPECT_GE(metrics.queue_depth.percentile(1.0), 1);
+    EXPECT_LE(metrics.queue_depth.percentile(0.0), metrics.queue_depth.percentile(1.0));
+}
+
+// Test the histogram buckets and percentile bounds
+TEST(ThreadPoolTest, MetricsHistogram)
+{
+    Histogram histogram;
+    EXPECT_EQ(histogram.percentile(0.5), 0);
+    for (uint64_t value : {0ULL, 1ULL, 5ULL, 6ULL, 7ULL, 1000ULL}) {
+        histogram.buckets[Histogram::bucket_of(value)]++;
+    }
+    EXPECT_EQ(histogram.count(), 6);
+    EXPECT_EQ(Histogram::bucket_of(0), 0);
+    EXPECT_EQ(Histogram::bucket_of(5), 3);
+    EXPECT_EQ(Histogram::bucket_of(UINT64_MAX), Histogram::kBucketCount - 1);
+    EXPECT_EQ(histogram.percentile(0.5), 7);
+    EXPECT_EQ(histogram.percentile(1.0), 1023);
+}
+
 } // namespace tw::test
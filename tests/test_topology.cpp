@@ -0,0 +1,169 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/ThreadPool.h"
+#include "Executor/Topology.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace tw::test {
+
+namespace {
+
+/**
+ * @brief Temporary sysfs-like tree removed on destruction.
+ */
+class FakeSysfs {
+public:
+    FakeSysfs()
+        : root_(std::filesystem::temp_directory_path() /
+                ("taskweave-sysfs-" + std::to_string(reinterpret_cast<uintptr_t>(this))))
+    {
+        std::filesystem::create_directories(root_);
+    }
+
+    ~FakeSysfs()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(root_, ec);
+    }
+
+    FakeSysfs(const FakeSysfs&) = delete;
+    auto operator=(const FakeSysfs&) -> FakeSysfs& = delete;
+
+    auto write(const std::filesystem::path& relative, const std::string& contents) const -> void
+    {
+        const auto path = root_ / relative;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path) << contents << "\n";
+    }
+
+    auto add_cpu(uint32_t id, uint32_t core_id, uint32_t package_id) const -> void
+    {
+        const std::string topology = "cpu/cpu" + std::to_string(id) + "/topology/";
+        write(topology + "core_id", std::to_string(core_id));
+        write(topology + "physical_package_id", std::to_string(package_id));
+    }
+
+    auto get_root() const -> const std::filesystem::path&
+    {
+        return root_;
+    }
+
+private:
+    std::filesystem::path root_;
+};
+
+} // namespace
+
+// Test CPU lists with single ids, ranges, duplicates and junk
+TEST(TopologyTest, ParseCpuList)
+{
+    EXPECT_EQ(parse_cpu_list("0-3,8,10-11\n"), (std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parse_cpu_list("5"), (std::vector<uint32_t>{5}));
+    EXPECT_EQ(parse_cpu_list(" 2 , 1-2 "), (std::vector<uint32_t>{1, 2}));
+    EXPECT_EQ(parse_cpu_list("3-1,x,4"), (std::vector<uint32_t>{4}));
+    EXPECT_TRUE(parse_cpu_list("").empty());
+}
+
+// Test a two-socket SMT machine read from a sysfs tree
+TEST(TopologyTest, FromSysfs)
+{
+    FakeSysfs sysfs;
+    sysfs.write("cpu/online", "0-7");
+    // Two packages of two cores with two hardware threads each; siblings are n and n + 4
+    for (uint32_t cpu = 0; cpu < 8; cpu++) {
+        sysfs.add_cpu(cpu, cpu % 2, (cpu / 2) % 2);
+    }
+    sysfs.write("node/node0/cpulist", "0-1,4-5");
+    sysfs.write("node/node1/cpulist", "2-3,6-7");
+
+    const auto topology = CpuTopology::from_sysfs(sysfs.get_root());
+
+    ASSERT_EQ(topology.size(), 8);
+    EXPECT_EQ(topology.get_cpus()[5], (CpuInfo{.id = 5, .core_id = 1, .package_id = 0, .numa_node = 0}));
+    EXPECT_EQ(topology.get_physical_cores(), (std::vector<uint32_t>{0, 1, 2, 3}));
+    EXPECT_EQ(topology.get_numa_nodes(), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(topology.get_node_cpus(1), (std::vector<uint32_t>{2, 3, 6, 7}));
+
+    const std::vector<uint32_t> cpuset{4, 5, 6, 9};
+    const auto restricted = topology.restricted_to(cpuset);
+    EXPECT_EQ(restricted.get_cpu_ids(), (std::vector<uint32_t>{4, 5, 6}));
+    EXPECT_EQ(restricted.get_physical_cores(), (std::vector<uint32_t>{4, 5, 6}));
+}
+
+// Test missing files: CPUs found from directory names, each its own core in node 0
+TEST(TopologyTest, FromSysfsFallbacks)
+{
+    FakeSysfs sysfs;
+    sysfs.write("cpu/cpu1/topology/physical_package_id", "-1");
+    sysfs.write("cpu/cpu0/online", "1");
+    sysfs.write("cpu/cpufreq/policy0", "");
+
+    const auto topology = CpuTopology::from_sysfs(sysfs.get_root());
+
+    EXPECT_EQ(topology.get_cpu_ids(), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(topology.get_physical_cores(), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(topology.get_numa_nodes(), (std::vector<uint32_t>{0}));
+
+    EXPECT_TRUE(CpuTopology::from_sysfs(sysfs.get_root() / "missing").empty());
+}
+
+// Test detection on this machine stays within the allowed CPUs
+TEST(TopologyTest, Detect)
+{
+    const auto topology = CpuTopology::detect();
+    ASSERT_FALSE(topology.empty());
+    EXPECT_LE(topology.get_physical_cores().size(), topology.size());
+
+    const auto allowed = get_thread_affinity();
+    if (!allowed.empty()) {
+        for (uint32_t cpu : topology.get_cpu_ids()) {
+            EXPECT_NE(std::ranges::find(allowed, cpu), allowed.end());
+        }
+    }
+}
+
+#if defined(__linux__)
+// Test pinned workers only run on the CPUs of their cpuset
+TEST(TopologyTest, PinnedThreadPool)
+{
+    const auto allowed = get_thread_affinity();
+    ASSERT_FALSE(allowed.empty());
+    const std::vector<uint32_t> cpuset{allowed.front()};
+
+    for (auto pinning : {WorkerPinning::None, WorkerPinning::PerCpu, WorkerPinning::PerPhysicalCore}) {
+        ThreadPool pool(ThreadPoolOptions{.min_threads = 2, .max_threads = 2, .pinning = pinning, .cpuset = cpuset});
+        pool.run();
+
+        std::mutex mtx;
+        std::vector<int> seen;
+        for (int i = 0; i < 16; i++) {
+            pool.add_task([&mtx, &seen]() {
+                std::lock_guard lck{mtx};
+                seen.push_back(sched_getcpu());
+            });
+        }
+        pool.wait();
+
+        ASSERT_EQ(seen.size(), 16);
+        for (int cpu : seen) {
+            EXPECT_EQ(cpu, static_cast<int>(cpuset.front()));
+        }
+    }
+}
+#endif
+
+} // namespace tw::test
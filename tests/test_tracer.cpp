@@ -0,0 +1,177 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/ThreadPoolExecutor.h"
+#include "Executor/Tracer.h"
+#include "TaskWeave/Task.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+namespace {
+
+/**
+ * @brief Task with a name (ITask::set_name is protected).
+ */
+template<typename Ret, typename... Args>
+class NamedTask : public Task<Ret, Args...> {
+public:
+    explicit NamedTask(const std::string& name)
+    {
+        this->set_name(name);
+    }
+};
+
+/**
+ * @brief Counts the occurrences of a substring.
+ */
+auto count_of(std::string_view text, std::string_view pattern) -> size_t
+{
+    size_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string_view::npos; pos = text.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+} // namespace
+
+// Test a traced diamond records one ordered event per task, in both dispatch modes
+TEST(TracerTest, RecordsTaskRuns)
+{
+    for (auto mode : {DispatchMode::Eager, DispatchMode::DependencyDriven}) {
+        Tracer tracer;
+        ThreadPoolExecutor executor(std::make_unique<ThreadPool>(2), ExecutorOptions{.dispatch_mode = mode});
+        executor.set_tracer(&tracer);
+        EXPECT_EQ(executor.get_tracer(), &tracer);
+
+        NamedTask<int> source("source");
+        source.set_callable([]() -> int {
+            return 1;
+        });
+        NamedTask<int, int> left("left");
+        left.set_callable([](int value) -> int {
+            return value + 1;
+        });
+        left.add_inward_edge<int>(source.get_outward_edge());
+        NamedTask<int, int> right("right");
+        right.set_callable([](int value) -> int {
+            return value + 2;
+        });
+        right.add_inward_edge<int>(source.get_outward_edge());
+        NamedTask<int, int, int> sink("sink");
+        sink.set_callable([](int a, int b) -> int {
+            return a + b;
+        });
+        sink.add_inward_edge<0>(left.get_outward_edge());
+        sink.add_inward_edge<1>(right.get_outward_edge());
+
+        for (ITask* task : std::vector<ITask*>{&sink, &right, &left, &source}) {
+            executor.add_task(task);
+        }
+        executor.run();
+        executor.wait();
+        ASSERT_EQ(sink.get_result(), 5);
+
+        const auto events = tracer.get_events();
+        ASSERT_EQ(events.size(), 4);
+        EXPECT_TRUE(std::ranges::is_sorted(events, {}, &TraceEvent::begin));
+        for (const auto& event : events) {
+            EXPECT_EQ(event.state, TaskState::Complete);
+            EXPECT_LE(event.queued, event.begin);
+            EXPECT_LE(event.begin, event.start);
+            EXPECT_LE(event.start, event.end);
+            EXPECT_LT(event.thread, 2U);
+        }
+        EXPECT_EQ(events.front().task, &source);
+        EXPECT_EQ(events.back().task, &sink);
+
+        tracer.clear();
+        EXPECT_TRUE(tracer.get_events().empty());
+    }
+}
+
+// Test the Chrome trace has a slice per task and a flow per dependency edge
+TEST(TracerTest, ChromeTrace)
+{
+    Tracer tracer;
+    ThreadPoolExecutor executor(std::make_unique<ThreadPool>(2),
+                                ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+    executor.set_tracer(&tracer);
+
+    NamedTask<int> producer("say \"hi\"\n");
+    producer.set_callable([]() -> int {
+        throw std::runtime_error("boom");
+    });
+    // Second input left unconnected
+    NamedTask<void, int, int> consumer("consumer");
+    consumer.set_callable([](int, int) {});
+    consumer.add_inward_edge<0>(producer.get_outward_edge());
+    Task<void> unnamed;
+    unnamed.set_callable([]() {});
+
+    executor.add_task(&producer);
+    executor.add_task(&consumer);
+    executor.add_task(&unnamed);
+    executor.run();
+    executor.wait();
+
+    std::ostringstream out;
+    tracer.write_chrome_trace(out);
+    const std::string trace = out.str();
+
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0);
+    EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+    EXPECT_NE(trace.find(R"("name":"say \"hi\"\n")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"consumer")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"task 0x)"), std::string::npos);
+    EXPECT_NE(trace.find(R"("state":"Failed")"), std::string::npos);
+    EXPECT_EQ(count_of(trace, R"("ph":"s")"), 1);
+    EXPECT_EQ(count_of(trace, R"("ph":"f")"), 1);
+    EXPECT_GE(count_of(trace, R"("name":"thread_name")"), 1);
+
+    const auto events = tracer.get_events();
+    const auto consumer_event = std::ranges::find(events, &consumer, &TraceEvent::task);
+    ASSERT_NE(consumer_event, events.end());
+    EXPECT_EQ(consumer_event->state, TaskState::Failed);
+    EXPECT_EQ(consumer_event->start, consumer_event->end);
+}
+
+// Test each thread records into its own buffer, with its own ordinal
+TEST(TracerTest, PerThreadBuffers)
+{
+    Tracer tracer;
+    Task<void> task;
+    task.set_callable([]() {});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&tracer, &task]() {
+            for (int i = 0; i < 100; i++) {
+                tracer.record(TraceEvent{.task = &task});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto events = tracer.get_events();
+    ASSERT_EQ(events.size(), 400);
+    for (uint32_t thread = 0; thread < 4; thread++) {
+        EXPECT_EQ(std::ranges::count(events, thread, &TraceEvent::thread), 100);
+    }
+}
+
+} // namespace tw::test
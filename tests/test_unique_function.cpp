@@ -0,0 +1,224 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/ThreadPool.h"
+#include "TaskWeave/UniqueFunction.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tw::test {
+
+namespace {
+
+int add_one(int value)
+{
+    return value + 1;
+}
+
+/**
+ * @brief Callable counting its live instances, to check destruction.
+ */
+struct CountedCallable {
+    explicit CountedCallable(int* live)
+        : live(live)
+    {
+        ++*live;
+    }
+
+    CountedCallable(const CountedCallable& other)
+        : live(other.live)
+    {
+        ++*live;
+    }
+
+    CountedCallable(CountedCallable&& other) noexcept
+        : live(other.live)
+    {
+        ++*live;
+    }
+
+    ~CountedCallable()
+    {
+        --*live;
+    }
+
+    auto operator()() const -> int
+    {
+        return 7;
+    }
+
+    int* live;
+};
+
+} // namespace
+
+// Test UniqueFunction default state is empty
+TEST(UniqueFunctionTest, DefaultIsEmpty)
+{
+    UniqueFunction<void()> fn;
+    EXPECT_FALSE(fn);
+    EXPECT_TRUE(fn == nullptr);
+    EXPECT_THROW(fn(), std::bad_function_call);
+}
+
+// Test UniqueFunction invokes lambdas, function pointers and std::function
+TEST(UniqueFunctionTest, InvokeCallables)
+{
+    UniqueFunction<int(int)> from_lambda = [](int value) {
+        return value * 2;
+    };
+    UniqueFunction<int(int)> from_pointer = &add_one;
+    UniqueFunction<int(int)> from_std_function = std::function<int(int)>([](int value) {
+        return value - 1;
+    });
+
+    EXPECT_EQ(from_lambda(21), 42);
+    EXPECT_EQ(from_pointer(41), 42);
+    EXPECT_EQ(from_std_function(43), 42);
+}
+
+// Test a void UniqueFunction discards the result of a value-returning callable
+TEST(UniqueFunctionTest, VoidDiscardsResult)
+{
+    int calls = 0;
+    UniqueFunction<void()> from_lambda = [&calls]() {
+        return ++calls;
+    };
+    auto large = [&calls, padding = std::array<char, 64>{}]() {
+        return ++calls + padding[0];
+    };
+    static_assert(!UniqueFunction<void()>::stores_inline<decltype(large)>);
+    UniqueFunction<void()> from_heap = std::move(large);
+    UniqueFunction<void(int)> from_pointer = &add_one;
+
+    from_lambda();
+    from_heap();
+    from_pointer(1);
+    EXPECT_EQ(calls, 2);
+}
+
+// Test UniqueFunction built from null callables is empty
+TEST(UniqueFunctionTest, NullCallablesAreEmpty)
+{
+    int (*null_pointer)(int) = nullptr;
+    std::function<int(int)> null_std_function;
+
+    UniqueFunction<int(int)> from_pointer = null_pointer;
+    UniqueFunction<int(int)> from_std_function = null_std_function;
+
+    EXPECT_FALSE(from_pointer);
+    EXPECT_FALSE(from_std_function);
+}
+
+// Test UniqueFunction accepts move-only captures
+TEST(UniqueFunctionTest, MoveOnlyCapture)
+{
+    UniqueFunction<int()> fn = [value = std::make_unique<int>(42)]() {
+        return *value;
+    };
+    EXPECT_EQ(fn(), 42);
+
+    UniqueFunction<int()> moved = std::move(fn);
+    EXPECT_FALSE(fn);
+    EXPECT_EQ(moved(), 42);
+}
+
+// Test UniqueFunction stores small callables inline and large ones on the heap
+TEST(UniqueFunctionTest, InlineStorage)
+{
+    auto small = [a = static_cast<void*>(nullptr), b = static_cast<void*>(nullptr)]() {
+        return a == b;
+    };
+    auto large = [buffer = std::array<char, 256>{}]() {
+        return buffer[0] == 0;
+    };
+
+    EXPECT_TRUE(UniqueFunction<bool()>::stores_inline<decltype(small)>);
+    EXPECT_FALSE(UniqueFunction<bool()>::stores_inline<decltype(large)>);
+
+    UniqueFunction<bool()> small_fn = small;
+    UniqueFunction<bool()> large_fn = large;
+    UniqueFunction<bool()> moved_large = std::move(large_fn);
+    EXPECT_TRUE(small_fn());
+    EXPECT_TRUE(moved_large());
+}
+
+// Test UniqueFunction destroys the stored callable exactly once
+TEST(UniqueFunctionTest, DestroysCallable)
+{
+    int live = 0;
+    {
+        UniqueFunction<int()> fn = CountedCallable{&live};
+        EXPECT_EQ(live, 1);
+
+        UniqueFunction<int()> moved = std::move(fn);
+        EXPECT_EQ(live, 1);
+        EXPECT_EQ(moved(), 7);
+
+        moved = nullptr;
+        EXPECT_EQ(live, 0);
+
+        moved = CountedCallable{&live};
+        EXPECT_EQ(live, 1);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+// Test UniqueFunction forwards arguments and mutates stateful callables
+TEST(UniqueFunctionTest, StatefulCallable)
+{
+    UniqueFunction<std::string(std::string)> fn = [count = 0](std::string text) mutable {
+        return text + std::to_string(++count);
+    };
+    EXPECT_EQ(fn("a"), "a1");
+    EXPECT_EQ(fn("b"), "b2");
+}
+
+// Test thread pools accept move-only tasks
+TEST(UniqueFunctionTest, ThreadPoolMoveOnlyTask)
+{
+    ThreadPool pool(2);
+    std::atomic<int> sum{0};
+
+    for (int i = 0; i < 10; i++) {
+        pool.add_task([&sum, value = std::make_unique<int>(i)]() {
+            sum.fetch_add(*value, std::memory_order_relaxed);
+        });
+    }
+    EXPECT_FALSE(pool.add_task(UniqueFunction<void()>{}));
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(sum.load(), 45);
+}
+
+// Test thread pools accept tasks returning a value
+TEST(UniqueFunctionTest, ThreadPoolValueReturningTask)
+{
+    ThreadPool pool(2);
+    std::atomic<int> calls{0};
+
+    pool.add_task([&calls]() {
+        return calls.fetch_add(1) + 42;
+    });
+    std::vector<std::function<int()>> tasks(3, [&calls]() {
+        return calls.fetch_add(1);
+    });
+    EXPECT_EQ(pool.add_tasks(tasks), 3);
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(calls.load(), 4);
+}
+
+} // namespace tw::test
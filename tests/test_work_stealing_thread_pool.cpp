@@ -0,0 +1,315 @@
+// Copyright 2026 Experian Elitiawan and contributors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "Executor/ThreadPoolExecutor.h"
+#include "Executor/WorkStealingDeque.h"
+#include "Executor/WorkStealingThreadPool.h"
+#include "TaskWeave/Task.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tw::test {
+
+// Test WorkStealingDeque owner push/pop is LIFO
+TEST(WorkStealingDequeTest, PushPopLifo)
+{
+    WorkStealingDeque<int*> deque(4);
+    int values[3] = {1, 2, 3};
+
+    for (auto& value : values) {
+        deque.push(&value);
+    }
+    EXPECT_EQ(deque.size(), 3);
+
+    EXPECT_EQ(*deque.pop(), &values[2]);
+    EXPECT_EQ(*deque.pop(), &values[1]);
+    EXPECT_EQ(*deque.pop(), &values[0]);
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_TRUE(deque.empty());
+}
+
+// Test WorkStealingDeque steal is FIFO
+TEST(WorkStealingDequeTest, StealFifo)
+{
+    WorkStealingDeque<int*> deque(4);
+    int values[3] = {1, 2, 3};
+
+    for (auto& value : values) {
+        deque.push(&value);
+    }
+
+    EXPECT_EQ(*deque.steal(), &values[0]);
+    EXPECT_EQ(*deque.steal(), &values[1]);
+    EXPECT_EQ(*deque.pop(), &values[2]);
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+// Test WorkStealingDeque grows past its initial capacity
+TEST(WorkStealingDequeTest, Grow)
+{
+    WorkStealingDeque<size_t> deque(2);
+
+    for (size_t i = 0; i < 100; i++) {
+        deque.push(i);
+    }
+    EXPECT_GE(deque.capacity(), 100);
+    EXPECT_EQ(deque.size(), 100);
+
+    for (size_t i = 0; i < 100; i++) {
+        EXPECT_EQ(*deque.steal(), i);
+    }
+}
+
+// Test WorkStealingDeque delivers every element exactly once under concurrent stealing
+TEST(WorkStealingDequeTest, ConcurrentSteal)
+{
+    constexpr size_t kItemCount = 20000;
+    constexpr size_t kThiefCount = 3;
+
+    WorkStealingDeque<size_t> deque(8);
+    std::vector<std::atomic<int>> seen(kItemCount);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < kThiefCount; t++) {
+        thieves.emplace_back([&deque, &seen, &done]() {
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (auto item = deque.steal()) {
+                    seen[*item].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < kItemCount; i++) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (auto item = deque.pop()) {
+                seen[*item].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (auto item = deque.pop()) {
+        seen[*item].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (size_t i = 0; i < kItemCount; i++) {
+        EXPECT_EQ(seen[i].load(), 1) << "Item " << i;
+    }
+}
+
+// Test WorkStealingThreadPool runs tasks submitted before run()
+TEST(WorkStealingThreadPoolTest, AddTask)
+{
+    WorkStealingThreadPool pool(2);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(pool.add_task([&counter]() {
+            counter.fetch_add(1, std::memory_order_acq_rel);
+        }));
+    }
+    EXPECT_EQ(pool.size(), 10);
+    EXPECT_EQ(pool.active_task_count(), 10);
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 10);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_TRUE(pool.is_idle());
+}
+
+// Test WorkStealingThreadPool rejects null callables
+TEST(WorkStealingThreadPoolTest, AddTaskNullFunction)
+{
+    WorkStealingThreadPool pool(2);
+
+    void (*null_func_ptr)() = nullptr;
+    EXPECT_FALSE(pool.add_task(null_func_ptr));
+
+    std::function<void()> null_std_func = nullptr;
+    EXPECT_FALSE(pool.add_task(null_std_func));
+
+    EXPECT_TRUE(pool.empty());
+}
+
+// Test WorkStealingThreadPool forwards arguments
+TEST(WorkStealingThreadPoolTest, AddTaskWithArguments)
+{
+    WorkStealingThreadPool pool(2);
+
+    std::atomic<int> result{0};
+    pool.add_task(
+        [&result](int a, int b) {
+            result.fetch_add(a + b, std::memory_order_acq_rel);
+        },
+        5, 3);
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(result.load(), 8);
+}
+
+// Test tasks spawned from workers (recursive fan-out) all complete
+TEST(WorkStealingThreadPoolTest, NestedSpawn)
+{
+    WorkStealingThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    std::function<void(int)> spawn = [&](int depth) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        if (depth == 0) {
+            return;
+        }
+        pool.add_task(spawn, depth - 1);
+        pool.add_task(spawn, depth - 1);
+    };
+
+    pool.add_task(spawn, 10);
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), (1 << 11) - 1);
+}
+
+// Test WorkStealingThreadPool add_tasks from outside and inside workers
+TEST(WorkStealingThreadPoolTest, AddTasksBatch)
+{
+    WorkStealingThreadPool pool(3);
+    std::atomic<int> counter{0};
+
+    std::vector<std::function<void()>> outer(10, [&pool, &counter]() {
+        std::vector<std::function<void()>> inner(10, [&counter]() {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        });
+        pool.add_tasks(inner);
+    });
+
+    EXPECT_EQ(pool.add_tasks(outer), 10);
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 100);
+}
+
+// Test WorkStealingThreadPool clear_queued_tasks
+TEST(WorkStealingThreadPoolTest, ClearQueuedTasks)
+{
+    WorkStealingThreadPool pool(2);
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 10; i++) {
+        pool.add_task([&counter]() {
+            counter.fetch_add(1, std::memory_order_acq_rel);
+        });
+    }
+
+    pool.clear_queued_tasks();
+    EXPECT_TRUE(pool.is_idle());
+    EXPECT_TRUE(pool.empty());
+
+    pool.run();
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 0);
+}
+
+// Test WorkStealingThreadPool on_complete callback
+TEST(WorkStealingThreadPoolTest, OnCompleteCallbackCalledOnce)
+{
+    std::atomic<int> callback_count{0};
+    {
+        WorkStealingThreadPool pool(3, [&callback_count]() {
+            callback_count.fetch_add(1, std::memory_order_acq_rel);
+        });
+        for (int i = 0; i < 10; i++) {
+            pool.add_task([]() {
+            });
+        }
+        pool.run();
+        pool.wait();
+    }
+    EXPECT_EQ(callback_count.load(), 1);
+}
+
+// Test calling run() twice does not spawn extra workers or lose tasks
+TEST(WorkStealingThreadPoolTest, RunTwice)
+{
+    WorkStealingThreadPool pool(2);
+    std::atomic<int> counter{0};
+
+    pool.run();
+    pool.add_task([&counter]() {
+        counter++;
+    });
+    pool.wait();
+    pool.run();
+    pool.add_task([&counter]() {
+        counter++;
+    });
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 2);
+}
+
+// Test try_execute_one runs queued tasks on the calling thread
+TEST(WorkStealingThreadPoolTest, TryExecuteOne)
+{
+    WorkStealingThreadPool pool(2);
+    std::atomic<int> counter{0};
+
+    // Workers are not running: only the calling thread can execute the tasks
+    for (int i = 0; i < 3; i++) {
+        pool.add_task([&counter]() {
+            counter++;
+        });
+    }
+    EXPECT_TRUE(pool.try_execute_one());
+    EXPECT_TRUE(pool.try_execute_one());
+    EXPECT_TRUE(pool.try_execute_one());
+    EXPECT_FALSE(pool.try_execute_one());
+
+    EXPECT_EQ(counter.load(), 3);
+    EXPECT_TRUE(pool.is_idle());
+    EXPECT_EQ(pool.size(), 0);
+}
+
+// Test ThreadPoolExecutor constructed with a work-stealing pool
+TEST(WorkStealingThreadPoolTest, ExecutorWithWorkStealingPool)
+{
+    ThreadPoolExecutor executor(
+        std::make_unique<WorkStealingThreadPool>(2), ExecutorOptions{.dispatch_mode = DispatchMode::DependencyDriven});
+
+    Task<int> producer;
+    producer.set_callable([]() -> int {
+        return 21;
+    });
+
+    Task<int, int> consumer;
+    consumer.set_callable([](int v) -> int {
+        return v * 2;
+    });
+    consumer.add_inward_edge<int>(producer.get_outward_edge());
+
+    executor.add_task(&consumer);
+    executor.add_task(&producer);
+    executor.run();
+    executor.wait();
+
+    EXPECT_EQ(consumer.get_result(), 42);
+}
+
+} // namespace tw::test